@@ -0,0 +1,307 @@
+#include <StatSim/Data.hpp>
+#include <StatSim/Distribution.hpp>
+#include <StatSim/Math.hpp>
+#include <StatSim/Random.hpp>
+#include <StatSim/Sort.hpp>
+#include <StatSim/ThreadPool.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+	// 측정 결과가 빌드마다 같은 순서와 형식으로 나오도록 시드, 크기, 반복 횟수를 모두 고정합니다.
+	constexpr std::uint64_t Seed = 1;
+	constexpr int MinRepetitionCount = 5;
+	constexpr int MaxRepetitionCount = 200;
+	constexpr double MinTotalSeconds = 0.2;
+
+	volatile double g_Sink;
+
+	struct Case final {
+		std::string Name;
+		std::int64_t Size;
+		std::int64_t ItemCount;
+		std::function<void()> Setup;
+		std::function<void()> Run;
+	};
+
+	struct Result final {
+		std::string Name;
+		std::int64_t Size;
+		int RepetitionCount;
+		double ItemsPerSecond;
+		double Latencies[5];
+	};
+
+	Result Measure(const Case& benchmarkCase) {
+		using Clock = std::chrono::steady_clock;
+
+		std::vector<double> latencies;
+		double totalSeconds = 0;
+		while (latencies.size() < MinRepetitionCount || (latencies.size() < MaxRepetitionCount && totalSeconds < MinTotalSeconds)) {
+			if (benchmarkCase.Setup) {
+				benchmarkCase.Setup();
+			}
+
+			const auto begin = Clock::now();
+			benchmarkCase.Run();
+			const double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+			latencies.push_back(seconds * 1e9);
+			totalSeconds += seconds;
+		}
+		std::sort(latencies.begin(), latencies.end());
+
+		const auto getPercentile = [&](double percentile) {
+			const std::size_t index = static_cast<std::size_t>(percentile / 100 * (latencies.size() - 1) + 0.5);
+			return latencies[index];
+		};
+
+		const double median = getPercentile(50);
+		return {
+			benchmarkCase.Name, benchmarkCase.Size, static_cast<int>(latencies.size()), benchmarkCase.ItemCount / (median * 1e-9),
+			{ latencies.front(), median, getPercentile(90), getPercentile(99), latencies.back() },
+		};
+	}
+
+	std::string FormatNumber(double value) {
+		// 유효숫자 4자리면 빌드 사이의 비교에 충분하고, 의미 없는 자릿수 때문에 diff가 커지지 않습니다.
+		char text[32];
+		return std::string(text, std::to_chars(text, text + sizeof(text), value, std::chars_format::general, 4).ptr);
+	}
+
+	void WriteJSON(std::ostream& stream, int threadCount, const std::vector<Result>& results) {
+		static constexpr const char* latencyNames[] = { "Min", "Median", "P90", "P99", "Max" };
+
+		stream << "{\n\t\"Seed\": " << Seed << ",\n\t\"ThreadCount\": " << threadCount << ",\n\t\"Results\": [";
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			const Result& result = results[i];
+			stream << (i == 0 ? "\n" : ",\n") << "\t\t{ \"Name\": \"" << result.Name << "\", \"Size\": " << result.Size
+				<< ", \"Repetitions\": " << result.RepetitionCount << ", \"ItemsPerSecond\": " << FormatNumber(result.ItemsPerSecond)
+				<< ", \"LatencyNanoseconds\": { ";
+			for (int j = 0; j < 5; ++j) {
+				stream << (j == 0 ? "" : ", ") << '"' << latencyNames[j] << "\": " << FormatNumber(result.Latencies[j]);
+			}
+			stream << " } }";
+		}
+		stream << "\n\t]\n}\n";
+	}
+
+	// BTPE로 뽑은 이항분포 난수를 BinomialPMF와 카이제곱 검정, 모멘트로 비교합니다. 측정 전에 확인해 틀린 구현의 성능을 기록하지 않습니다.
+	bool CheckBinomialSampler(int tryCount, double probability) {
+		static constexpr int drawCount = 1000000;
+		static constexpr double minExpectedCount = 100;
+
+		StatSim::BinomialDistribution distribution(tryCount, probability);
+		std::vector<double> values(drawCount);
+		distribution.Generate(values);
+
+		// 평균에서 6 표준편차 밖은 꼬리 구간 하나로 묶고, 안쪽은 기대 빈도가 minExpectedCount 이상이 되도록 이웃한 값을 묶습니다.
+		const double mean = tryCount * probability, standardDeviation = std::sqrt(mean * (1 - probability));
+		const int begin = static_cast<int>(std::max(mean - 6 * standardDeviation, 0.0));
+		const int end = static_cast<int>(std::min(mean + 6 * standardDeviation, static_cast<double>(tryCount)));
+		std::vector<int> binEnds;
+		std::vector<double> expectedCounts;
+		expectedCounts.push_back(StatSim::BinomialCDF(tryCount, begin - 1, probability) * drawCount);
+		binEnds.push_back(begin);
+		double expectedCount = 0;
+		for (int k = begin; k <= end; ++k) {
+			expectedCount += StatSim::BinomialPMF(tryCount, k, probability) * drawCount;
+			if (expectedCount >= minExpectedCount || k == end) {
+				expectedCounts.push_back(expectedCount);
+				binEnds.push_back(k + 1);
+				expectedCount = 0;
+			}
+		}
+		expectedCounts.push_back(StatSim::BinomialSurvival(tryCount, end + 1, probability) * drawCount);
+
+		std::vector<std::int64_t> observedCounts(expectedCounts.size());
+		StatSim::Moments moments;
+		for (const double value : values) {
+			++observedCounts[std::upper_bound(binEnds.begin(), binEnds.end(), static_cast<int>(value)) - binEnds.begin()];
+			moments.Add(value);
+		}
+
+		double chiSquare = 0;
+		int degreeOfFreedom = -1;
+		for (std::size_t i = 0; i < expectedCounts.size(); ++i) {
+			if (expectedCounts[i] < 1) continue;
+
+			const double difference = observedCounts[i] - expectedCounts[i];
+			chiSquare += difference * difference / expectedCounts[i];
+			++degreeOfFreedom;
+		}
+
+		// 자유도가 크면 카이제곱 통계량은 평균 df, 분산 2df인 정규분포에 가깝습니다. 표준화한 값이 6을 넘으면 실패로 봅니다.
+		const double chiSquareScore = (chiSquare - degreeOfFreedom) / std::sqrt(2.0 * degreeOfFreedom);
+		const double meanScore = (moments.GetMean() - mean) / (standardDeviation / std::sqrt(drawCount));
+		const double varianceRatio = moments.GetSquaredDeviationSum() / drawCount / (standardDeviation * standardDeviation);
+		const bool isPassed = std::abs(chiSquareScore) < 6 && std::abs(meanScore) < 6 && std::abs(varianceRatio - 1) < 0.01;
+
+		std::cerr << "Check.BinomialSampler/B(" << tryCount << ',' << probability << "): chi-square " << FormatNumber(chiSquare) << " (df "
+			<< degreeOfFreedom << "), mean z " << FormatNumber(meanScore) << ", variance ratio " << FormatNumber(varianceRatio)
+			<< (isPassed ? "\n" : " FAILED\n");
+		return isPassed;
+	}
+
+	std::vector<double> CreateValues(int size) {
+		StatSim::NormalDistribution distribution(0, 1);
+		std::vector<double> values(size);
+		distribution.Generate(values);
+		return values;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	const std::string outputPath = argc > 1 ? argv[1] : "benchmark.json";
+	const std::filesystem::path temporaryDirectory = std::filesystem::temp_directory_path();
+	const std::string textPath = (temporaryDirectory / "StatSimBenchmark.txt").string();
+	const std::string binaryPath = (temporaryDirectory / "StatSimBenchmark.bin").string();
+
+	StatSim::SetGlobalSeed(Seed);
+	StatSim::ThreadPool threadPool;
+
+	if (!CheckBinomialSampler(1000000, 0.3) || !CheckBinomialSampler(200000, 0.5)) return 1;
+
+	static constexpr int dataSizes[] = { 1000, 10000, 100000, 1000000 };
+	static constexpr int sampleSizes[] = { 10, 100, 1000, 10000 };
+	static constexpr int basePopulationSize = 1000000;
+	static constexpr int queryCount = 10000;
+	static constexpr int sampleMeanDrawCount = 1000000;
+
+	const std::unique_ptr<StatSim::Population> basePopulation(new StatSim::Population(basePopulationSize, new StatSim::NormalDistribution(0, 1), &threadPool));
+	std::vector<Case> cases;
+
+	// Distribution::Generate
+	for (const int size : dataSizes) {
+		const auto output = std::make_shared<std::vector<double>>(size);
+		const auto binomial = std::make_shared<StatSim::BinomialDistribution>(100, 0.3);
+		const auto largeBinomial = std::make_shared<StatSim::BinomialDistribution>(1000000, 0.3);
+		const auto normal = std::make_shared<StatSim::NormalDistribution>(0, 1);
+
+		cases.push_back({ "Distribution.Generate/Binomial(100,0.3)", size, size, nullptr, [=] { binomial->Generate(*output); } });
+		cases.push_back({ "Distribution.Generate/Binomial(1e6,0.3)", size, size, nullptr, [=] { largeBinomial->Generate(*output); } });
+		cases.push_back({ "Distribution.Generate/Normal(0,1)", size, size, nullptr, [=] { normal->Generate(*output); } });
+	}
+
+	// Data 생성(생성 + 정렬)과 정렬
+	for (const int size : dataSizes) {
+		cases.push_back({ "Population.Construct/Normal(0,1)", size, size, nullptr, [&threadPool, size] {
+			const StatSim::Population population(size, new StatSim::NormalDistribution(0, 1), &threadPool);
+			g_Sink = population.GetMean();
+		} });
+
+		const auto source = std::make_shared<const std::vector<double>>(CreateValues(size));
+		const auto values = std::make_shared<std::vector<double>>();
+		cases.push_back({ "SortValues", size, size, [=] { *values = *source; }, [=, &threadPool] { StatSim::SortValues(*values, &threadPool); } });
+	}
+
+	// Population::Sample: 쌓인 표본이 뒤의 반복과 경우를 느리게 하지 않도록 매번 표본을 모두 지웁니다.
+	const auto clearSamples = [&] { basePopulation->ClearSamples(); };
+	for (const int size : sampleSizes) {
+		cases.push_back({ "Population.Sample/Replacement", size, size, clearSamples, [&, size] {
+			g_Sink = basePopulation->Sample(size, true)->GetMean();
+		} });
+		cases.push_back({ "Population.Sample/NoReplacement", size, size, clearSamples, [&, size] {
+			g_Sink = basePopulation->Sample(size, false)->GetMean();
+		} });
+	}
+
+	// GetMean, GetVariance, GetProbability
+	for (const int size : dataSizes) {
+		const auto population = std::make_shared<StatSim::Population>(size, new StatSim::NormalDistribution(0, 1), &threadPool);
+		cases.push_back({ "Data.GetMean", size, queryCount, nullptr, [=] {
+			double sum = 0;
+			for (int i = 0; i < queryCount; ++i) {
+				sum += population->GetMean();
+			}
+			g_Sink = sum;
+		} });
+		cases.push_back({ "Data.GetVariance", size, queryCount, nullptr, [=] {
+			double sum = 0;
+			for (int i = 0; i < queryCount; ++i) {
+				sum += population->GetVariance();
+			}
+			g_Sink = sum;
+		} });
+
+		const auto bounds = std::make_shared<const std::vector<double>>(CreateValues(queryCount * 2));
+		cases.push_back({ "Data.GetProbability", size, queryCount, nullptr, [=] {
+			double sum = 0;
+			for (int i = 0; i < queryCount; ++i) {
+				const auto [begin, end] = std::minmax((*bounds)[2 * i], (*bounds)[2 * i + 1]);
+				sum += population->GetProbability(begin, end);
+			}
+			g_Sink = sum;
+		} });
+	}
+
+	// BinomialPMF
+	for (const int size : sampleSizes) {
+		cases.push_back({ "BinomialPMF", size, size + 1, nullptr, [size] {
+			double sum = 0;
+			for (int k = 0; k <= size; ++k) {
+				sum += StatSim::BinomialPMF(size, k, 0.3);
+			}
+			g_Sink = sum;
+		} });
+	}
+
+	// Population::Save, Load, SaveBinary, LoadBinary
+	for (const int size : dataSizes) {
+		const auto population = std::make_shared<StatSim::Population>(size, new StatSim::NormalDistribution(0, 1), &threadPool);
+		// Load와 LoadBinary는 바로 앞의 Save와 SaveBinary가 남긴 파일을 읽습니다.
+		cases.push_back({ "Population.Save", size, size, nullptr, [=, &threadPool] { population->Save(textPath, &threadPool); } });
+		cases.push_back({ "Population.Load", size, size, nullptr, [=, &threadPool] {
+			StatSim::NormalDistributionGenerator distributionGenerator;
+			g_Sink = StatSim::Population::Load(textPath, &distributionGenerator, threadPool).GetMean();
+		} });
+		cases.push_back({ "Population.SaveBinary", size, size, nullptr, [=] { population->SaveBinary(binaryPath); } });
+		cases.push_back({ "Population.LoadBinary", size, size, nullptr, [=] {
+			g_Sink = StatSim::Population::LoadBinary(binaryPath).GetMean();
+		} });
+	}
+
+	// CreateSampleMeanPopulation: 크기와 관계없이 한 번에 뽑는 원소의 수를 같게 맞춥니다.
+	for (const int size : sampleSizes) {
+		const int count = sampleMeanDrawCount / size;
+		cases.push_back({ "Population.CreateSampleMeanPopulation/Replacement", size, sampleMeanDrawCount, nullptr, [&, size, count] {
+			const std::unique_ptr<StatSim::Population> sampleMeans(basePopulation->CreateSampleMeanPopulation(size, count, true, threadPool));
+			g_Sink = sampleMeans->GetMean();
+		} });
+		cases.push_back({ "Population.CreateSampleMeanPopulation/NoReplacement", size, sampleMeanDrawCount, nullptr, [&, size, count] {
+			const std::unique_ptr<StatSim::Population> sampleMeans(basePopulation->CreateSampleMeanPopulation(size, count, false, threadPool));
+			g_Sink = sampleMeans->GetMean();
+		} });
+	}
+
+	std::vector<Result> results;
+	for (const Case& benchmarkCase : cases) {
+		results.push_back(Measure(benchmarkCase));
+
+		const Result& result = results.back();
+		std::cerr << result.Name << '/' << result.Size << ": " << FormatNumber(result.Latencies[1]) << "ns, "
+			<< FormatNumber(result.ItemsPerSecond) << " items/s\n";
+	}
+
+	std::filesystem::remove(textPath);
+	std::filesystem::remove(binaryPath);
+
+	std::ofstream file(outputPath);
+	WriteJSON(file, threadPool.GetThreadCount(), results);
+	if (!file) {
+		std::cerr << "failed to write " << outputPath << '\n';
+		return 1;
+	}
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace StatSim {
+	class Arena final {
+	public:
+		static constexpr std::size_t DefaultBlockSize = 1 << 20;
+
+	private:
+		std::vector<std::unique_ptr<std::byte[]>> m_Blocks;
+		std::size_t m_BlockSize;
+		std::byte* m_Current = nullptr;
+		std::size_t m_Remaining = 0;
+		std::size_t m_AllocatedSize = 0;
+		std::size_t m_ReservedSize = 0;
+
+	public:
+		explicit Arena(std::size_t blockSize = DefaultBlockSize) noexcept;
+		Arena(const Arena&) = delete;
+		Arena(Arena&& arena) noexcept;
+		~Arena() = default;
+
+	public:
+		Arena& operator=(const Arena&) = delete;
+		Arena& operator=(Arena&& arena) noexcept;
+
+	public:
+		void* Allocate(std::size_t size, std::size_t alignment);
+		template<typename T>
+		T* Allocate(std::size_t count) {
+			return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+		}
+		void Release() noexcept;
+
+		std::size_t GetAllocatedSize() const noexcept;
+		std::size_t GetReservedSize() const noexcept;
+	};
+}
\ No newline at end of file
@@ -1,9 +1,21 @@
 #pragma once
 
+#include <StatSim/Arena.hpp>
 #include <StatSim/Distribution.hpp>
+#include <StatSim/MappedFile.hpp>
+#include <StatSim/PopulationFile.hpp>
+#include <StatSim/Math.hpp>
+#include <StatSim/Random.hpp>
+#include <StatSim/ThreadPool.hpp>
 
-#include <map>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <random>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -11,11 +23,16 @@ namespace StatSim {
 	class Data {
 	private:
 		std::vector<double> m_Data;
+		std::shared_ptr<const MappedFile> m_MappedFile;
+		std::span<const double> m_Values;
 		Distribution* m_Distribution;
+		Moments m_Moments;
 
 	protected:
-		Data(int size, Distribution* distribution);
-		Data(std::vector<double>&& data, Distribution* distribution) noexcept;
+		Data(int size, Distribution* distribution, ThreadPool* threadPool = nullptr);
+		Data(std::vector<double>&& data, Distribution* distribution);
+		Data(std::vector<double>&& data, Distribution* distribution, const Moments& moments);
+		Data(std::shared_ptr<const MappedFile> mappedFile, std::span<const double> values, Distribution* distribution, const Moments& moments) noexcept;
 
 	public:
 		Data(const Data&) = delete;
@@ -25,70 +42,219 @@ namespace StatSim {
 	public:
 		Data& operator=(const Data&) = delete;
 		Data& operator=(Data&& data) noexcept;
-		double operator[](int index) const noexcept;
+		// 파일을 매핑한 모집단은 int의 범위보다 클 수 있으므로 크기와 위치는 64비트로 다룹니다.
+		virtual double operator[](std::int64_t index) const;
 
 	public:
 		virtual std::string GetName() const = 0;
-		const Distribution* GetDistribution() const noexcept;
-		Distribution* GetDistribution() noexcept;
+		virtual const Distribution* GetDistribution() const noexcept;
+		virtual Distribution* GetDistribution() noexcept;
 
-		int GetSize() const noexcept;
+		virtual std::int64_t GetSize() const noexcept;
 		virtual double GetMean() const;
 		virtual double GetVariance() const;
 		virtual double GetStandardDeviation() const;
 
-		double GetProbability(double begin, double end) const noexcept;
+		double GetProbability(double begin, double end) const;
+		std::vector<double> GetProbability(const std::vector<Interval>& intervals) const;
+
+		// 정렬된 데이터에서 value보다 작은(isInclusive이면 작거나 같은) 원소의 개수를 구합니다. 앞의 hint개는 검사하지 않습니다.
+		virtual std::int64_t GetRank(double value, bool isInclusive, std::int64_t hint = 0) const;
+
+		bool IsMapped() const noexcept;
 
 	protected:
-		std::vector<double>::const_iterator begin() const;
-		std::vector<double>::const_iterator end() const;
+		const double* begin() const noexcept;
+		const double* end() const noexcept;
 
-		double GetSum() const noexcept;
-		double GetDeviationSum(double mean) const noexcept;
+		const Moments& GetMoments() const noexcept;
+		void SetMoments(const Moments& moments) noexcept;
 	};
 
 	class Sample;
 
+	struct SampleCoverage final {
+		int SampleSize;
+		int SampleCount;
+		// k의 순서대로, 모평균이 표본평균 ± k * 표준오차 안에 들어간 표본의 비율입니다.
+		std::vector<double> HitRates;
+	};
+
+	// 모집단이 쓰는 메모리의 바이트 수입니다. 파일을 매핑한 모집단의 값은 운영체제가 회수할 수 있으므로 세지 않습니다.
+	struct PopulationMemoryUsage final {
+		std::size_t ValueSize;
+		// 표본 객체와 요약 통계, 관리용 정보입니다. 표본을 제거해도 남습니다.
+		std::size_t SampleSize;
+		// 표본의 인덱스와 다시 쓰려고 남겨 둔 블록입니다. 예산을 넘으면 남겨 둔 블록, 가장 오래 쓰지 않은 표본 순으로 해제합니다.
+		std::size_t IndexSize;
+		std::size_t TotalSize;
+		int EvictedSampleCount;
+	};
+
 	class Population final : public Data {
+	public:
+		static constexpr std::size_t ReductionBlockSize = 1024;
+		// 비복원 추출에서 모집단이 표본보다 이 배수 이상 크면 Floyd의 방법을, 아니면 선택 표집을 씁니다.
+		static constexpr int FloydSamplingRatio = 16;
+		// 표본의 인덱스는 이 크기의 블록을 차례로 잘라 할당하고, 블록의 표본이 모두 제거되면 블록을 풀에 돌려줘 다시 씁니다.
+		// 이보다 큰 표본의 인덱스만 따로 할당합니다.
+		static constexpr std::size_t IndexBlockSize = Arena::DefaultBlockSize;
+		static constexpr std::size_t UnlimitedMemoryBudget = SIZE_MAX;
+		// 모집단이 이 크기 이하면 표본의 인덱스를 32비트로, 넘으면 64비트로 저장합니다.
+		static constexpr std::int64_t MaxNarrowIndexPopulationSize = std::int64_t(1) << 32;
+
+	private:
+		struct IndexBlock final {
+			std::unique_ptr<std::byte[]> Indices;
+			std::size_t Size;
+			int SampleCount;
+		};
+
+		// 제거한 표본은 같은 스트림으로 인덱스를 다시 뽑아 복원합니다.
+		struct SampleRecord final {
+			std::uint64_t RandomStream;
+			bool EnableReplacement;
+			int IndexBlock;
+			std::list<int>::iterator RecentUse;
+		};
+
 	private:
-		std::map<int, std::vector<StatSim::Sample*>> m_Samples;
-		int m_SampleCount = 0;
+		std::vector<StatSim::Sample*> m_Samples;
+		std::unordered_map<int, std::vector<StatSim::Sample*>> m_SampleGroups;
+		std::vector<int> m_SampleSizes;
+		Arena m_SampleArena;
+		std::vector<IndexBlock> m_IndexBlocks;
+		// 표본이 모두 제거돼 다시 쓸 수 있는 m_IndexBlocks의 자리입니다.
+		std::vector<int> m_FreeIndexBlocks;
+		// 표본이 모두 제거된 IndexBlockSize 크기의 블록입니다. 예산을 넘으면 표본보다 먼저 해제합니다.
+		std::vector<std::unique_ptr<std::byte[]>> m_IndexBlockPool;
+		int m_OpenIndexBlock = -1;
+		std::size_t m_OpenIndexBlockUsage = 0;
+		std::vector<SampleRecord> m_SampleRecords;
+		// 인덱스를 가진 표본의 번호입니다. 최근에 쓴 표본이 앞에 옵니다.
+		std::list<int> m_RecentSamples;
+		std::size_t m_IndexSize = 0;
+		std::size_t m_MemoryBudget = UnlimitedMemoryBudget;
+		int m_EvictedSampleCount = 0;
+		// 표본 하나, 또는 표본평균 시뮬레이션의 반복 하나마다 스트림을 하나씩 나눠 주므로 스레드 수와 관계없이 결과가 같습니다.
+		RandomEngine m_RandomEngine = CreateRandomEngine();
+		mutable std::uint64_t m_RandomStreamCount = 0;
 
 	private:
-		Population(std::vector<double>&& data, Distribution* distribution) noexcept;
+		Population(std::vector<double>&& data, Distribution* distribution);
+		Population(std::vector<double>&& data, Distribution* distribution, const Moments& moments);
+		Population(std::shared_ptr<const MappedFile> mappedFile, std::span<const double> values, Distribution* distribution, const Moments& moments) noexcept;
 
 	public:
-		Population(int size, Distribution* distribution);
+		Population(int size, Distribution* distribution, ThreadPool* threadPool = nullptr);
 		Population(const Population&) = delete;
-		Population(Population&& population) noexcept = default;
+		// 표본이 모집단을 가리키므로, 옮길 때 표본이 새 모집단을 가리키게 합니다.
+		Population(Population&& population) noexcept;
 		virtual ~Population() override;
 
 	public:
 		Population& operator=(const Population&) = delete;
-		Population& operator=(Population&& population) noexcept = default;
+		Population& operator=(Population&& population) noexcept;
 
 	public:
 		virtual std::string GetName() const override;
 
+		// 비복원 추출에서 size가 모집단보다 크면 std::invalid_argument를 던집니다.
 		StatSim::Sample* Sample(int size, bool enableReplacement);
+		// 반환하는 표본은 이번 호출에서 제거하지 않으므로, 한 번에 예산보다 많이 뽑으면 다음에 표본을 뽑거나 복원할 때까지 예산을 넘습니다.
+		std::vector<StatSim::Sample*> SampleBatch(int size, int count, bool enableReplacement, ThreadPool& threadPool);
+		// 상수가 아닌 판은 제거된 표본을 복원하고 가장 최근에 쓴 표본으로 표시합니다. 상수 판과 GetSamples는 제거된 표본을 그대로 반환합니다.
 		const StatSim::Sample* GetSample(int index) const;
 		StatSim::Sample* GetSample(int index);
-		std::map<int, std::vector<const StatSim::Sample*>> GetSamples() const;
-		std::map<int, std::vector<StatSim::Sample*>> GetSamples();
+		std::span<const StatSim::Sample* const> GetSamples() const noexcept;
+		std::span<StatSim::Sample* const> GetSamples() noexcept;
+		std::span<const StatSim::Sample* const> GetSamples(int size) const noexcept;
+		std::span<StatSim::Sample* const> GetSamples(int size) noexcept;
+		// 표본의 인덱스 하나가 차지하는 바이트 수입니다.
+		std::size_t GetIndexWidth() const noexcept;
+		const std::vector<int>& GetSampleSizes() const noexcept;
 		int GetSampleCount() const noexcept;
+		// 모든 표본을 없애고 메모리를 해제합니다. 표본을 가리키던 포인터는 모두 무효가 됩니다.
+		void ClearSamples() noexcept;
 		Population* CreateSampleMeanPopulation(int size) const;
+		Population* CreateSampleMeanPopulation(int size, int count, bool enableReplacement, ThreadPool& threadPool) const;
+		Moments SummarizeSampleMeans(int size, int count, bool enableReplacement, ThreadPool& threadPool) const;
+		// Sample::GetConfidenceLevel의 구간으로 모평균을 추정했을 때의 적중 확률을 표본의 크기별로 구합니다.
+		// 표본마다 저장된 모멘트로 한 번만 계산하므로, k의 개수와 관계없이 표본을 한 번만 훑습니다.
+		std::vector<SampleCoverage> EvaluateCoverage(std::span<const double> k, ThreadPool& threadPool) const;
+
+		PopulationMemoryUsage GetMemoryUsage() const noexcept;
+		std::size_t GetMemoryBudget() const noexcept;
+		// 사용량이 budget을 넘으면 바로 표본을 제거합니다. 모집단의 값과 표본의 요약 통계는 제거하지 않으므로 예산을 넘을 수 있습니다.
+		void SetMemoryBudget(std::size_t budget);
 
-		static Population Load(const std::string& path, DistributionGenerator* distributionGenerator);
-		void Save(const std::string& path) const;
+		static Population Load(const std::string& path, DistributionGenerator* distributionGenerator, ThreadPool& threadPool);
+		static Population LoadBinary(const std::string& path, DistributionGenerator* distributionGenerator = nullptr);
+		void Save(const std::string& path, ThreadPool* threadPool = nullptr) const;
+		void SaveBinary(const std::string& path) const;
+		// 메모리에 다 올리지 않고 외부 정렬로 정렬된 바이너리 모집단 파일을 만듭니다. memoryBudget은 바이트 단위입니다.
+		static void GenerateBinary(const std::string& path, std::uint64_t size, Distribution* distribution, ThreadPool& threadPool,
+			std::size_t memoryBudget = PopulationFileWriter::DefaultMemoryBudget);
+		static void ConvertToBinary(const std::string& textPath, const std::string& binaryPath, DistributionGenerator* distributionGenerator,
+			ThreadPool& threadPool, std::size_t memoryBudget = PopulationFileWriter::DefaultMemoryBudget);
+
+	private:
+		void CheckSampleSize(int size, bool enableReplacement) const;
+		template<typename T>
+		void DrawIndices(T* indices, int size, bool enableReplacement, RandomEngine& randomEngine) const;
+		template<typename T>
+		StatSim::Sample* CreateSample(StatSim::Sample* storage, int index, const T* indices, int size);
+		// indices에 GetIndexWidth() 크기의 인덱스를 뽑아 storage에 표본을 만듭니다.
+		StatSim::Sample* DrawSample(StatSim::Sample* storage, int index, std::byte* indices, int size, bool enableReplacement, RandomEngine& randomEngine);
+		// size 바이트의 인덱스를 잘라 주고, 그 블록의 표본 수를 늘립니다.
+		std::pair<int, std::byte*> AllocateIndices(std::size_t size);
+		int CreateIndexBlock(std::size_t size);
+		void AttachIndexBlock(int index, int indexBlock);
+		void ReleaseIndexBlock(int indexBlock) noexcept;
+		void AdoptSamples() noexcept;
+		void Evict(int index) noexcept;
+		void Restore(int index);
+		// [keptBegin, keptEnd) 번째 표본은 제거하지 않습니다.
+		void EnforceMemoryBudget(int keptBegin = 0, int keptEnd = 0) noexcept;
+		std::vector<StatSim::Sample*>& GetSampleGroup(int size);
+		Distribution* CreateSampleMeanDistribution(int size) const;
+		template<typename F>
+		void ReduceSamples(int size, int count, bool enableReplacement, ThreadPool& threadPool, F&& function) const;
+	};
+
+	enum class BootstrapStatistic {
+		Mean,
+		Median,
+		Variance,
+	};
+
+	struct BootstrapInterval final {
+		double Estimate;
+		double StandardError;
+		Interval Percentile;
+		Interval BCa;
 	};
 
 	class Sample final : public Data {
+		friend class Population;
+
 	private:
 		Population* m_Population = nullptr;
 		int m_Index;
 
+		// 모집단의 크기에 따라 둘 중 하나만 씁니다.
+		const std::uint32_t* m_Indices = nullptr;
+		const std::uint64_t* m_WideIndices = nullptr;
+		std::int64_t m_RangeBegin = 0;
+		int m_ViewSize = 0;
+		bool m_IsView = false;
+		bool m_IsEvicted = false;
+
 	public:
 		Sample(Population* population, int index, std::vector<double>&& data, Distribution* distribution) noexcept;
+		Sample(Population* population, int index, const std::uint32_t* indices, int size) noexcept;
+		Sample(Population* population, int index, const std::uint64_t* indices, int size) noexcept;
+		Sample(Population* population, int index, std::int64_t rangeBegin, int rangeSize) noexcept;
 		Sample(const Sample&) = delete;
 		Sample(Sample&& sample) noexcept = default;
 		virtual ~Sample() override = default;
@@ -96,15 +262,38 @@ namespace StatSim {
 	public:
 		Sample& operator=(const Sample&) = delete;
 		Sample& operator=(Sample&& sample) noexcept = default;
+		virtual double operator[](std::int64_t index) const override;
 
 	public:
 		virtual std::string GetName() const override;
+		virtual const Distribution* GetDistribution() const noexcept override;
+		virtual Distribution* GetDistribution() noexcept override;
 		const Population* GetPopulation() const noexcept;
 		Population* GetPopulation() noexcept;
 		int GetIndex() const noexcept;
+		bool IsView() const noexcept;
+		// 모집단의 원소를 가리키는 인덱스입니다. 연속한 구간을 가리키는 표본이거나 제거된 표본이면 nullptr입니다.
+		// 모집단이 Population::MaxNarrowIndexPopulationSize보다 크면 GetIndices 대신 GetWideIndices가 인덱스를 반환합니다.
+		const std::uint32_t* GetIndices() const noexcept;
+		const std::uint64_t* GetWideIndices() const noexcept;
+		// 제거된 표본은 크기와 요약 통계만 남습니다. 원소에 접근하면 예외를 던지므로, 먼저 Population::GetSample로 복원해야 합니다.
+		bool IsEvicted() const noexcept;
+		void Evict() noexcept;
 
+		virtual std::int64_t GetSize() const noexcept override;
 		virtual double GetVariance() const override;
 
+		virtual std::int64_t GetRank(double value, bool isInclusive, std::int64_t hint = 0) const override;
+
 		std::pair<Interval, double> GetConfidenceLevel(double k) const;
+		// 재표본을 Sample로 만들지 않고 뽑은 인덱스에서 바로 통계량을 계산합니다. 재표본마다 스트림을 하나씩 나눠 주므로 스레드 수와 관계없이 결과가 같습니다.
+		// confidence는 0과 1 사이의 신뢰도이고, BCa 구간의 가속 상수는 잭나이프로 구합니다.
+		BootstrapInterval Bootstrap(BootstrapStatistic statistic, int replicateCount, double confidence, ThreadPool& threadPool) const;
+
+	private:
+		template<typename F>
+		void ForEach(F&& function) const;
+		void UpdateMoments() noexcept;
+		void CheckEvicted() const;
 	};
 }
\ No newline at end of file
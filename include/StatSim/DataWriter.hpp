@@ -0,0 +1,38 @@
+#pragma once
+
+#include <StatSim/Data.hpp>
+#include <StatSim/ThreadPool.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+
+namespace StatSim {
+	class DataWriter final {
+	public:
+		static constexpr int BlockSize = 1 << 16;
+
+	private:
+		std::ostream& m_Stream;
+		char m_Separator;
+		std::optional<int> m_Precision;
+		ThreadPool* m_ThreadPool;
+
+	public:
+		// precision이 없으면 다시 읽었을 때 같은 값이 되는 가장 짧은 표현으로, 있으면 고정 소수점으로 씁니다.
+		DataWriter(std::ostream& stream, char separator, std::optional<int> precision = std::nullopt, ThreadPool* threadPool = nullptr) noexcept;
+		DataWriter(const DataWriter&) = delete;
+		~DataWriter() = default;
+
+	public:
+		DataWriter& operator=(const DataWriter&) = delete;
+
+	public:
+		void Write(const Data& data);
+		void Write(const Data& data, std::int64_t begin, std::int64_t end, int stride = 1);
+
+	private:
+		void Format(const Data& data, std::int64_t begin, std::int64_t end, int stride, std::string& buffer) const;
+	};
+}
\ No newline at end of file
@@ -1,10 +1,17 @@
 #pragma once
 
+#include <StatSim/Random.hpp>
+#include <StatSim/Sampler.hpp>
+
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <random>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace StatSim {
 	class Interval final {
@@ -67,6 +74,9 @@ namespace StatSim {
 
 namespace StatSim {
 	class Distribution {
+	private:
+		RandomEngine m_RandomEngine = CreateRandomEngine();
+
 	public:
 		Distribution() noexcept = default;
 		Distribution(const Distribution&) = delete;
@@ -86,15 +96,29 @@ namespace StatSim {
 		virtual double GetStandardDeviation() const;
 
 		virtual double Generate() = 0;
+		virtual void Generate(std::span<double> values);
 		virtual double GetProbability(double begin, double end) const = 0;
+
+		void SetRandomEngine(const RandomEngine& randomEngine) noexcept;
+
+	protected:
+		RandomEngine& GetRandomEngine() noexcept;
 	};
 
 	class BinomialDistribution final : public Distribution {
+	public:
+		static constexpr int MaxCDFTableTryCount = 1 << 20;
+
 	private:
-		std::binomial_distribution<> m_Distribution;
+		int m_TryCount;
+		double m_Probability;
+		BinomialSampler m_Sampler;
+		mutable std::vector<double> m_CDFTable;
+		mutable std::vector<double> m_SurvivalTable;
+		mutable std::once_flag m_CDFTableFlag;
 
 	public:
-		BinomialDistribution(int tryCount, double probability) noexcept;
+		BinomialDistribution(int tryCount, double probability);
 		BinomialDistribution(const BinomialDistribution&) = delete;
 		virtual ~BinomialDistribution() override = default;
 
@@ -111,9 +135,16 @@ namespace StatSim {
 		virtual double GetVariance() const override;
 
 		virtual double Generate() override;
+		virtual void Generate(std::span<double> values) override;
 		virtual double GetProbability(double begin, double end) const override;
 		int GetTryCount() const noexcept;
 		double GetProbability() const noexcept;
+
+	private:
+		double GetCDF(int occurCount) const;
+		// P(X >= occurCount)입니다. 평균보다 위의 구간은 이 값의 차로 구해야 정밀도가 남습니다.
+		double GetSurvival(int occurCount) const;
+		void CreateCDFTable() const;
 	};
 
 	class NormalDistribution final : public Distribution {
@@ -138,15 +169,25 @@ namespace StatSim {
 		virtual double GetStandardDeviation() const override;
 
 		virtual double Generate() override;
+		virtual void Generate(std::span<double> values) override;
 		virtual double GetProbability(double begin, double end) const override;
 	};
 }
 
 namespace StatSim {
+	// "ILVL 0"의 응답이 "<구현 수준> SERVE"이면 프로그램을 "SERVE" 인자로 한 번만 실행하고 표준 입출력으로 계속 요청합니다.
+	// 요청은 "<PDF|CDF|ICDF> <개수> <x...>" 한 줄, 응답은 같은 개수의 값 한 줄이며 응답마다 출력을 비워야 합니다. "QUIT"을 받으면 종료합니다.
 	class PDFProgram {
+	public:
+		static constexpr std::size_t MaxBatchSize = 4096;
+
+	private:
+		class Process;
+
 	private:
 		std::string m_ProgramPath;
 		bool m_HasCDF = false, m_HasICDF = false;
+		std::shared_ptr<Process> m_Process;
 
 	private:
 		PDFProgram() noexcept = default;
@@ -166,9 +207,76 @@ namespace StatSim {
 		double PDF(double x) const;
 		double CDF(double x) const;
 		double ICDF(double x) const;
+		std::vector<double> PDF(std::span<const double> x) const;
+		std::vector<double> CDF(std::span<const double> x) const;
+		std::vector<double> ICDF(std::span<const double> x) const;
+
+		bool HasCDF() const noexcept;
+		bool HasICDF() const noexcept;
+		bool IsPersistent() const noexcept;
 
 	private:
 		double GetValue(const std::string_view& command, double x) const;
+		std::vector<double> GetValues(const std::string_view& command, std::span<const double> x) const;
+		std::string Run(const std::string_view& command, double x) const;
+	};
+}
+
+namespace StatSim {
+	// PDF를 구간별로 적분한 CDF 표를 한 번 만들고, 이후의 CDF, ICDF, 난수 생성은 프로그램 없이 표에서 계산합니다.
+	class ProgramDistribution final : public Distribution {
+	public:
+		static constexpr int InitialCellCount = 64;
+		static constexpr int MaxCellCount = 1 << 16;
+		static constexpr int MaxRefinementDepth = 24;
+		static constexpr double Tolerance = 1e-10;
+
+	private:
+		// 각 구간에서 확률밀도는 일차함수로 보므로 구간 안의 CDF는 이차함수이고, 역함수도 닫힌 꼴로 구할 수 있습니다.
+		struct Table final {
+			std::vector<double> Nodes;
+			std::vector<double> CDF;
+			std::vector<double> LeftDensities, RightDensities;
+			std::vector<int> Guide;
+			double Mean = 0, Variance = 0;
+		};
+
+	private:
+		PDFProgram m_Program;
+		std::shared_ptr<const Table> m_Table;
+		std::uniform_real_distribution<> m_Uniform;
+
+	public:
+		explicit ProgramDistribution(PDFProgram program, const Interval& support = Interval::Real);
+		ProgramDistribution(const ProgramDistribution&) = delete;
+		virtual ~ProgramDistribution() override = default;
+
+	private:
+		ProgramDistribution(PDFProgram program, std::shared_ptr<const Table> table) noexcept;
+
+	public:
+		ProgramDistribution& operator=(const ProgramDistribution&) = delete;
+
+	public:
+		virtual std::string GetName() const override;
+		virtual std::string GetExpression() const override;
+		virtual RandomVariable GetRandomVariable() const noexcept override;
+		virtual Distribution* Copy() const override;
+
+		virtual double GetMean() const override;
+		virtual double GetVariance() const override;
+
+		virtual double Generate() override;
+		virtual void Generate(std::span<double> values) override;
+		virtual double GetProbability(double begin, double end) const override;
+		double CDF(double x) const noexcept;
+		double ICDF(double p) const noexcept;
+		const PDFProgram& GetProgram() const noexcept;
+		int GetCellCount() const noexcept;
+
+	private:
+		static Interval FindSupport(const PDFProgram& program, const Interval& support);
+		static std::shared_ptr<const Table> CreateTable(const PDFProgram& program, const Interval& support);
 	};
 }
 
@@ -224,4 +332,23 @@ namespace StatSim {
 		virtual void SetParameter(const std::string& name, double value) override;
 		virtual Distribution* Generate() const override;
 	};
+
+	class ProgramDistributionGenerator final : public DistributionGenerator {
+	private:
+		std::string m_ProgramPath;
+		std::optional<double> m_SupportBegin;
+		std::optional<double> m_SupportEnd;
+
+	public:
+		explicit ProgramDistributionGenerator(std::string programPath) noexcept;
+		ProgramDistributionGenerator(const ProgramDistributionGenerator&) = delete;
+		virtual ~ProgramDistributionGenerator() override = default;
+
+	public:
+		ProgramDistributionGenerator& operator=(const ProgramDistributionGenerator&) = delete;
+
+	public:
+		virtual void SetParameter(const std::string& name, double value) override;
+		virtual Distribution* Generate() const override;
+	};
 }
\ No newline at end of file
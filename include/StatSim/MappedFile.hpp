@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace StatSim {
+	class MappedFile final {
+	private:
+		const std::byte* m_Data = nullptr;
+		std::size_t m_Size = 0;
+#ifdef _WIN32
+		void* m_File = nullptr;
+		void* m_Mapping = nullptr;
+#endif
+
+	public:
+		explicit MappedFile(const std::string& path);
+		MappedFile(const MappedFile&) = delete;
+		~MappedFile();
+
+	public:
+		MappedFile& operator=(const MappedFile&) = delete;
+
+	public:
+		const std::byte* GetData() const noexcept;
+		std::size_t GetSize() const noexcept;
+	};
+}
\ No newline at end of file
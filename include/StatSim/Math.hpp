@@ -1,6 +1,39 @@
 #pragma once
 
+#include <cstdint>
+
 namespace StatSim {
+	// Loader의 안장점 전개로 배정밀도에서 계산합니다. 기존 다배정밀도 구현과의 상대 오차는 1e-12 이내입니다.
 	double BinomialPMF(int tryCount, int occurCount, double probability);
+	// P(X <= occurCount)를 정칙화된 불완전 베타 함수로 계산합니다.
+	double BinomialCDF(int tryCount, int occurCount, double probability);
+	// P(X >= occurCount)를 계산합니다. 윗꼬리에서 1 - BinomialCDF로 구하면 정밀도를 모두 잃으므로 따로 둡니다.
+	double BinomialSurvival(int tryCount, int occurCount, double probability);
 	double NormalCDF(double value, double mean, double standardDeviation);
+	double NormalICDF(double probability, double mean, double standardDeviation);
+}
+
+namespace StatSim {
+	class Moments final {
+	private:
+		std::int64_t m_Count = 0;
+		double m_Mean = 0, m_SquaredDeviationSum = 0;
+
+	public:
+		Moments() noexcept = default;
+		Moments(std::int64_t count, double mean, double squaredDeviationSum) noexcept;
+		Moments(const Moments& moments) noexcept = default;
+		~Moments() = default;
+
+	public:
+		Moments& operator=(const Moments& moments) noexcept = default;
+
+	public:
+		void Add(double value) noexcept;
+		void Merge(const Moments& moments) noexcept;
+
+		std::int64_t GetCount() const noexcept;
+		double GetMean() const noexcept;
+		double GetSquaredDeviationSum() const noexcept;
+	};
 }
\ No newline at end of file
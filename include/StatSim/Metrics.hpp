@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace StatSim {
+	class Metrics final {
+	public:
+		// 지연 시간은 나노초 단위의 2의 거듭제곱 구간으로 셉니다. i번째 구간은 [2^i, 2^(i+1))입니다.
+		static constexpr int LatencyBucketCount = 64;
+
+		struct Operation final {
+			std::uint64_t CallCount = 0;
+			std::uint64_t TotalNanoseconds = 0;
+			std::uint64_t MaxNanoseconds = 0;
+			std::uint64_t ByteCount = 0;
+			std::uint64_t AllocationCount = 0;
+			std::uint64_t AllocatedByteCount = 0;
+			std::array<std::uint64_t, LatencyBucketCount> LatencyHistogram{};
+
+			// 백분위수가 속한 구간의 상한을 반환하므로 실제 값보다 최대 두 배 클 수 있습니다.
+			std::uint64_t GetLatencyPercentile(double percentile) const noexcept;
+		};
+
+		// 만들 때부터 없어질 때까지의 시간과 그동안의 할당 횟수를 기록합니다. 작업 중 스레드 풀에서 일어난 할당도 포함됩니다.
+		// 할당 횟수는 STATSIM_COUNT_ALLOCATIONS를 켜고 빌드한 StatSim처럼 RecordAllocation을 호출하는 실행 파일에서만 셉니다.
+		class Timer final {
+		private:
+			Metrics& m_Metrics;
+			std::string m_Name;
+			std::uint64_t m_ByteCount;
+			std::chrono::steady_clock::time_point m_Begin;
+			std::uint64_t m_AllocationCount, m_AllocatedByteCount;
+
+		public:
+			Timer(Metrics& metrics, std::string name, std::uint64_t byteCount) noexcept;
+			Timer(const Timer&) = delete;
+			~Timer();
+
+		public:
+			Timer& operator=(const Timer&) = delete;
+
+		public:
+			void AddBytes(std::uint64_t byteCount) noexcept;
+		};
+
+	private:
+		mutable std::mutex m_Mutex;
+		std::map<std::string, Operation> m_Operations;
+
+	public:
+		Metrics() = default;
+		Metrics(const Metrics&) = delete;
+		~Metrics() = default;
+
+	public:
+		Metrics& operator=(const Metrics&) = delete;
+
+	public:
+		Timer Measure(std::string name, std::uint64_t byteCount = 0);
+		void Record(const std::string& name, std::uint64_t nanoseconds, std::uint64_t byteCount, std::uint64_t allocationCount,
+			std::uint64_t allocatedByteCount);
+		void Reset();
+
+		std::map<std::string, Operation> GetOperations() const;
+		void Print(std::ostream& stream) const;
+		void Save(const std::string& path) const;
+
+		// 전역 operator new를 바꾼 실행 파일이 할당마다 호출합니다. 라이브러리는 operator new를 바꾸지 않으므로,
+		// 아무도 호출하지 않으면 할당 횟수를 세지 않은 것으로 보고 보고서에서 뺍니다.
+		static void RecordAllocation(std::size_t size) noexcept;
+		static bool IsAllocationCounted() noexcept;
+		static std::uint64_t GetAllocationCount() noexcept;
+		static std::uint64_t GetAllocatedByteCount() noexcept;
+	};
+}
\ No newline at end of file
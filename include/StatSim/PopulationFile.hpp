@@ -0,0 +1,73 @@
+#pragma once
+
+#include <StatSim/Distribution.hpp>
+#include <StatSim/Math.hpp>
+#include <StatSim/ThreadPool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace StatSim {
+	// 바이너리 모집단 파일의 헤더입니다. 헤더 바로 뒤에 Size개의 double이 리틀 엔디언으로 이어집니다.
+	struct PopulationFileHeader final {
+		static constexpr char MagicValue[8] = { 'S', 'S', 'P', 'O', 'P', 'B', 'I', 'N' };
+		static constexpr std::uint32_t CurrentVersion = 1;
+		static constexpr std::uint32_t SortedFlag = 1 << 0;
+		static constexpr std::uint32_t BinomialDistributionType = 1;
+		static constexpr std::uint32_t NormalDistributionType = 2;
+
+		char Magic[8];
+		std::uint32_t Version;
+		std::uint32_t Flags;
+		std::uint64_t Size;
+		std::uint32_t DistributionType;
+		std::uint32_t Reserved;
+		double DistributionParameters[2];
+		double Mean;
+		double SquaredDeviationSum;
+
+		static PopulationFileHeader Create(const Distribution* distribution, const Moments& moments) noexcept;
+	};
+	static_assert(sizeof(PopulationFileHeader) == 64);
+}
+
+namespace StatSim {
+	// 메모리보다 큰 모집단을 정렬된 바이너리 모집단 파일로 씁니다. 받은 값을 메모리 예산만큼 모아 정렬한 뒤 런 파일로 내보내고,
+	// Finish에서 런 파일들을 mmap으로 읽으며 한 번에 병합합니다. 런 파일은 결과 파일 옆에 만들어지고 소멸자에서 지워집니다.
+	class PopulationFileWriter final {
+	public:
+		static constexpr std::size_t DefaultMemoryBudget = std::size_t(1) << 30;
+		static constexpr std::size_t MinRunSize = 1 << 16;
+
+	private:
+		std::string m_Path;
+		ThreadPool* m_ThreadPool;
+		std::vector<double> m_Run;
+		std::size_t m_RunSize;
+		std::vector<std::string> m_RunPaths;
+		Moments m_Moments;
+
+	public:
+		explicit PopulationFileWriter(std::string path, std::size_t memoryBudget = DefaultMemoryBudget, ThreadPool* threadPool = nullptr);
+		PopulationFileWriter(const PopulationFileWriter&) = delete;
+		~PopulationFileWriter();
+
+	public:
+		PopulationFileWriter& operator=(const PopulationFileWriter&) = delete;
+
+	public:
+		void Write(std::span<const double> values);
+		void Finish(const Distribution* distribution);
+		void Finish(DistributionGenerator* distributionGenerator);
+
+		std::uint64_t GetSize() const noexcept;
+		const Moments& GetMoments() const noexcept;
+
+	private:
+		void FlushRun();
+		void Merge(const PopulationFileHeader& header);
+	};
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace StatSim {
+	// Philox4x32-10(Salmon 외, 2011)입니다. 키는 시드이고, 128비트 카운터의 상위 64비트는 스트림 번호, 하위 64비트는 블록 번호입니다.
+	// 상태가 작고 블록마다 독립적으로 계산되므로, 스레드나 표본마다 스트림을 나눠 주면 실행 순서와 관계없이 결과가 같습니다.
+	class Philox final {
+	public:
+		using result_type = std::uint64_t;
+		static constexpr int BatchBlockCount = 8;
+
+	private:
+		std::uint64_t m_Seed;
+		std::uint64_t m_Stream;
+		std::uint64_t m_Block = 0;
+		std::array<std::uint64_t, 2> m_Buffer{};
+		int m_BufferIndex = 2;
+
+	public:
+		explicit Philox(std::uint64_t seed, std::uint64_t stream = 0) noexcept;
+		Philox(const Philox& philox) noexcept = default;
+		~Philox() = default;
+
+	public:
+		Philox& operator=(const Philox& philox) noexcept = default;
+		result_type operator()() noexcept;
+
+	public:
+		static constexpr result_type min() noexcept {
+			return 0;
+		}
+		static constexpr result_type max() noexcept {
+			return UINT64_MAX;
+		}
+
+	public:
+		void Fill(std::span<std::uint64_t> bits) noexcept;
+		// 같은 시드에서 index마다 다른 스트림을 만듭니다. 원래 생성기의 상태는 바뀌지 않습니다.
+		Philox Split(std::uint64_t index) const noexcept;
+
+		std::uint64_t GetSeed() const noexcept;
+		std::uint64_t GetStream() const noexcept;
+
+	private:
+		std::array<std::uint64_t, 2> Generate(std::uint64_t block) const noexcept;
+		// block부터 BatchBlockCount개의 블록을 만들어 bits에 2 * BatchBlockCount개를 씁니다.
+		void GenerateBatch(std::uint64_t block, std::uint64_t* bits) const noexcept;
+	};
+
+	// 다른 생성기로 바꾸려면 생성자(시드, 스트림), Fill, Split을 갖춘 타입으로 바꾸면 됩니다.
+	using RandomEngine = Philox;
+
+	// 전역 시드는 처음에 std::random_device로 정해지고, SetGlobalSeed로 바꾸면 이후에 만드는 생성기가 모두 재현됩니다.
+	std::uint64_t GetGlobalSeed() noexcept;
+	void SetGlobalSeed(std::uint64_t seed) noexcept;
+	// 전역 시드에서 호출 순서대로 새 스트림을 엽니다. 여러 스레드에서 호출해도 안전합니다.
+	RandomEngine CreateRandomEngine() noexcept;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace StatSim {
+	// 주어진 범위를 균등한 64비트 난수로 채우는 함수입니다. 한 번에 여러 개를 채워 호출 비용을 줄입니다.
+	using RandomBitsFunction = std::function<void(std::span<std::uint64_t> bits)>;
+
+	// 256층 Ziggurat으로 표준정규분포를 따르는 난수를 채웁니다.
+	// 블록마다 모든 값을 분기 없이 먼저 계산하고(벡터화됨), 약 1%의 거부된 값만 따로 다시 뽑습니다.
+	void GenerateStandardNormal(std::span<double> values, const RandomBitsFunction& random);
+}
+
+
+namespace StatSim {
+	// 분산이 작아 확률이 무시할 수 없는 범위가 표에 들어가면 안내 표로 역변환하고, 그렇지 않으면 BTPE를 씁니다.
+	class BinomialSampler final {
+	public:
+		static constexpr int MaxTableSize = 1 << 12;
+
+	private:
+		int m_TryCount;
+		double m_Probability;
+
+		int m_TableBegin = 0;
+		std::vector<double> m_CDF;
+		std::vector<int> m_Guide;
+
+		// Kachitvichyanukul, Schmeiser(1988)의 BTPE에서 쓰는 값들입니다.
+		double m_R = 0, m_Q = 0, m_NRQ = 0;
+		double m_FM = 0, m_XM = 0, m_XL = 0, m_XR = 0, m_C = 0;
+		double m_LambdaL = 0, m_LambdaR = 0;
+		double m_P1 = 0, m_P2 = 0, m_P3 = 0, m_P4 = 0;
+		int m_M = 0;
+
+	public:
+		BinomialSampler(int tryCount, double probability);
+		BinomialSampler(const BinomialSampler& sampler) = default;
+		~BinomialSampler() = default;
+
+	public:
+		BinomialSampler& operator=(const BinomialSampler& sampler) = default;
+
+	public:
+		void Generate(std::span<double> values, const RandomBitsFunction& random) const;
+		bool IsTabulated() const noexcept;
+
+	private:
+		void GenerateFromTable(std::span<double> values, const RandomBitsFunction& random) const;
+		void GenerateBTPE(std::span<double> values, const RandomBitsFunction& random) const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <StatSim/Simulator.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace StatSim {
+	// 메뉴 없이 실행할 시나리오입니다. 확장자가 .json이면 JSON으로, 아니면 INI로 읽습니다.
+	// 목록은 공백이나 쉼표로 구분한 문자열, 또는 JSON 배열로 적습니다. 예:
+	//
+	// Seed = 42
+	// [Distribution]
+	// Type = Binomial            ; Binomial, Normal, Program(Path 필요). 나머지 키는 SetParameter로 넘깁니다.
+	// TryCount = 100
+	// Probability = 0.3
+	// [Population]
+	// Source = Distribution      ; Distribution, Text, Binary, BinaryDistribution(Path에 외부 정렬), ConvertText(Path를 BinaryPath로)
+	// Size = 1000000
+	// MemoryBudget = 512         ; MB 단위입니다. 넘으면 오래 쓰지 않은 표본의 인덱스부터 버립니다.
+	// [Sampling]
+	// Sizes = 5 30 100
+	// Count = 10000              ; SampleMeans나 Coverage를 구하려면 1 이상이어야 합니다.
+	// Replacement = true
+	// [Statistics]
+	// SampleMeans = true         ; 표본을 저장하지 않고 표본평균의 평균과 분산을 구합니다.
+	// Coverage = 1 1.96 2 3      ; 표본을 저장한 뒤 신뢰 상수마다 모평균 추정 적중 확률을 구합니다.
+	// [Output]
+	// CSV = result.csv
+	// JSON = result.json
+	// Population = population.txt
+	// BinaryPopulation = population.bin
+	// Metrics = metrics.json       ; 실행이 끝나면 성능 지표를 씁니다.
+	class Scenario final {
+	private:
+		struct Result final {
+			std::string Statistic;
+			std::optional<int> SampleSize;
+			std::optional<double> K;
+			double Value;
+		};
+
+	private:
+		std::optional<std::uint64_t> m_Seed;
+
+		std::string m_DistributionType;
+		std::string m_ProgramPath;
+		std::vector<std::pair<std::string, double>> m_DistributionParameters;
+
+		std::string m_PopulationSource;
+		std::string m_PopulationPath, m_BinaryPopulationPath;
+		std::int64_t m_PopulationSize = 0;
+		double m_MemoryBudget = 0;
+
+		std::vector<int> m_SampleSizes;
+		int m_SampleCount = 0;
+		bool m_EnableReplacement = true;
+
+		bool m_SummarizeSampleMeans = false;
+		std::vector<double> m_CoverageK;
+
+		std::string m_CSVPath, m_JSONPath;
+		std::string m_PopulationOutputPath, m_BinaryPopulationOutputPath;
+		std::string m_MetricsPath;
+
+	public:
+		explicit Scenario(const std::string& path);
+		Scenario(const Scenario&) = delete;
+		~Scenario() = default;
+
+	public:
+		Scenario& operator=(const Scenario&) = delete;
+
+	public:
+		// 시드를 정하지 않았으면 현재 전역 시드를 쓰고, 결과에 기록해 다시 실행할 수 있게 합니다.
+		void Run(Simulator& simulator) const;
+
+	private:
+		DistributionGenerator* CreateDistributionGenerator() const;
+		void LoadPopulation(Simulator& simulator) const;
+
+		static void WriteCSV(std::ostream& stream, std::uint64_t seed, const std::vector<Result>& results);
+		static void WriteJSON(std::ostream& stream, std::uint64_t seed, const std::vector<Result>& results);
+	};
+}
\ No newline at end of file
@@ -2,7 +2,11 @@
 
 #include <StatSim/Data.hpp>
 #include <StatSim/Distribution.hpp>
+#include <StatSim/Metrics.hpp>
+#include <StatSim/ThreadPool.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace StatSim {
@@ -10,9 +14,13 @@ namespace StatSim {
 	private:
 		Population* m_Population = nullptr;
 		Data* m_SelectedData = nullptr;
+		ThreadPool m_ThreadPool;
+		Metrics m_Metrics;
+		std::string m_MetricsPath;
+		std::size_t m_MemoryBudget = Population::UnlimitedMemoryBudget;
 
 	public:
-		Simulator() noexcept = default;
+		Simulator() = default;
 		Simulator(const Simulator&) = delete;
 		~Simulator();
 
@@ -22,12 +30,22 @@ namespace StatSim {
 	public:
 		void GeneratePopulation(int size, Distribution* distribution);
 		void LoadPopulation(const std::string& path, DistributionGenerator* distributionGenerator);
+		void LoadBinaryPopulation(const std::string& path, DistributionGenerator* distributionGenerator);
+		void GenerateBinaryPopulation(const std::string& path, std::int64_t size, DistributionGenerator* distributionGenerator);
+		void ConvertPopulation(const std::string& textPath, const std::string& binaryPath, DistributionGenerator* distributionGenerator);
 
 		Data* GetSelectedData() noexcept;
 		void SelectPopulation() noexcept;
 		void SelectSample(int index);
 		bool IsPopulationSelected() const noexcept;
+		ThreadPool& GetThreadPool() noexcept;
+		Metrics& GetMetrics() noexcept;
+		// 경로를 정하면 Simulator가 없어질 때 성능 지표를 그 파일에 씁니다.
+		void SetMetricsPath(std::string path);
+		// 지금의 모집단과 앞으로 만들 모집단에 메모리 예산을 적용합니다. 단위는 바이트입니다.
+		void SetMemoryBudget(std::size_t budget);
 
 		void PrintSelectedData();
+		void PrintSelectedData(std::int64_t begin, std::int64_t end, int stride);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <StatSim/ThreadPool.hpp>
+
+#include <cstddef>
+#include <span>
+
+namespace StatSim {
+	// 작은 입력은 std::sort로, 그보다 큰 입력은 부호 비트 변환을 한 키로 11비트씩 6번 LSD 기수 정렬합니다.
+	// 기수 정렬은 입력과 같은 크기의 버퍼가 필요하므로, MaxRadixSortSize보다 크면 버퍼가 덜 필요한 병렬 병합 정렬을 씁니다.
+	inline constexpr std::size_t MinRadixSortSize = 1 << 12;
+	inline constexpr std::size_t MaxRadixSortSize = std::size_t(1) << 27;
+
+	void SortValues(std::span<double> values, ThreadPool* threadPool = nullptr);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace StatSim {
+	class ThreadPool final {
+	public:
+		using ChunkFunction = std::function<void(std::size_t begin, std::size_t end, int chunk)>;
+
+	private:
+		std::vector<std::thread> m_Workers;
+		std::queue<std::function<void()>> m_Tasks;
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+		bool m_IsStopping = false;
+
+	public:
+		explicit ThreadPool(int threadCount = 0);
+		ThreadPool(const ThreadPool&) = delete;
+		~ThreadPool();
+
+	public:
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+	public:
+		int GetThreadCount() const noexcept;
+
+		// [0, count)를 최대 GetThreadCount()개의 연속 구간으로 나누어 병렬로 실행하고, 모두 끝날 때까지 대기합니다.
+		void ParallelFor(std::size_t count, const ChunkFunction& function);
+
+	private:
+		void Run();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include <StatSim/Arena.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+namespace StatSim {
+	Arena::Arena(std::size_t blockSize) noexcept
+		: m_BlockSize(blockSize) {
+		assert(blockSize > 0);
+	}
+	Arena::Arena(Arena&& arena) noexcept
+		: m_Blocks(std::move(arena.m_Blocks)), m_BlockSize(arena.m_BlockSize), m_Current(arena.m_Current),
+		m_Remaining(arena.m_Remaining), m_AllocatedSize(arena.m_AllocatedSize), m_ReservedSize(arena.m_ReservedSize) {
+		arena.m_Current = nullptr;
+		arena.m_Remaining = 0;
+		arena.m_AllocatedSize = 0;
+		arena.m_ReservedSize = 0;
+	}
+
+	Arena& Arena::operator=(Arena&& arena) noexcept {
+		m_Blocks = std::move(arena.m_Blocks);
+		m_BlockSize = arena.m_BlockSize;
+		m_Current = std::exchange(arena.m_Current, nullptr);
+		m_Remaining = std::exchange(arena.m_Remaining, 0);
+		m_AllocatedSize = std::exchange(arena.m_AllocatedSize, 0);
+		m_ReservedSize = std::exchange(arena.m_ReservedSize, 0);
+		return *this;
+	}
+
+	void* Arena::Allocate(std::size_t size, std::size_t alignment) {
+		assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+		const std::size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(m_Current) % alignment) % alignment;
+		if (m_Current == nullptr || padding + size > m_Remaining) {
+			// 블록보다 큰 요청은 전용 블록을 만들고, 현재 블록은 계속 사용합니다.
+			const std::size_t blockSize = size + alignment;
+			if (blockSize > m_BlockSize) {
+				auto& block = m_Blocks.emplace_back(new std::byte[blockSize]);
+				const std::size_t blockPadding = (alignment - reinterpret_cast<std::uintptr_t>(block.get()) % alignment) % alignment;
+				m_AllocatedSize += size;
+				m_ReservedSize += blockSize;
+				return block.get() + blockPadding;
+			}
+
+			m_Current = m_Blocks.emplace_back(new std::byte[m_BlockSize]).get();
+			m_Remaining = m_BlockSize;
+			m_ReservedSize += m_BlockSize;
+			return Allocate(size, alignment);
+		}
+
+		std::byte* const result = m_Current + padding;
+		m_Current += padding + size;
+		m_Remaining -= padding + size;
+		m_AllocatedSize += size;
+		return result;
+	}
+	void Arena::Release() noexcept {
+		m_Blocks.clear();
+		m_Current = nullptr;
+		m_Remaining = 0;
+		m_AllocatedSize = 0;
+		m_ReservedSize = 0;
+	}
+
+	std::size_t Arena::GetAllocatedSize() const noexcept {
+		return m_AllocatedSize;
+	}
+	std::size_t Arena::GetReservedSize() const noexcept {
+		return m_ReservedSize;
+	}
+}
\ No newline at end of file
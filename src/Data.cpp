@@ -1,31 +1,72 @@
 #include <StatSim/Data.hpp>
 
+#include <StatSim/DataWriter.hpp>
+#include <StatSim/PopulationFile.hpp>
+#include <StatSim/Sort.hpp>
+
 #include <algorithm>
+#include <bit>
 #include <cassert>
+#include <charconv>
 #include <cmath>
+#include <cstring>
 #include <fstream>
+#include <functional>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <numeric>
 #include <stdexcept>
 #include <random>
+#include <tuple>
 
 namespace StatSim {
-	Data::Data(int size, Distribution* distribution)
+	Data::Data(int size, Distribution* distribution, ThreadPool* threadPool)
 		: m_Distribution(distribution) {
 		assert(size >= 0);
 		assert(m_Distribution != nullptr);
 
-		std::generate_n(std::back_inserter(m_Data), size, [&]() {
-			return distribution->Generate();
-		});
-		std::sort(m_Data.begin(), m_Data.end());
+		m_Data.resize(size);
+		distribution->Generate(m_Data);
+		SortValues(m_Data, threadPool);
+		m_Values = m_Data;
+
+		for (const double value : m_Data) {
+			m_Moments.Add(value);
+		}
+	}
+	Data::Data(std::vector<double>&& data, Distribution* distribution)
+		: m_Data(std::move(data)), m_Distribution(distribution) {
+		if (!std::is_sorted(m_Data.begin(), m_Data.end())) {
+			SortValues(m_Data);
+		}
+		m_Values = m_Data;
+
+		for (const double value : m_Data) {
+			m_Moments.Add(value);
+		}
+	}
+	Data::Data(std::vector<double>&& data, Distribution* distribution, const Moments& moments)
+		: m_Data(std::move(data)), m_Distribution(distribution), m_Moments(moments) {
+		assert(m_Moments.GetCount() == static_cast<std::int64_t>(m_Data.size()));
+
+		if (!std::is_sorted(m_Data.begin(), m_Data.end())) {
+			SortValues(m_Data);
+		}
+		m_Values = m_Data;
+	}
+	Data::Data(std::shared_ptr<const MappedFile> mappedFile, std::span<const double> values, Distribution* distribution, const Moments& moments) noexcept
+		: m_MappedFile(std::move(mappedFile)), m_Values(values), m_Distribution(distribution), m_Moments(moments) {
+		assert(m_MappedFile != nullptr);
+		assert(m_Moments.GetCount() == static_cast<std::int64_t>(m_Values.size()));
 	}
-	Data::Data(std::vector<double>&& data, Distribution* distribution) noexcept
-		: m_Data(std::move(data)), m_Distribution(distribution) {}
 
 	Data::Data(Data&& data) noexcept
-		: m_Data(std::move(data.m_Data)), m_Distribution(data.m_Distribution) {
+		: m_Data(std::move(data.m_Data)), m_MappedFile(std::move(data.m_MappedFile)), m_Values(data.m_Values),
+		m_Distribution(data.m_Distribution), m_Moments(data.m_Moments) {
+		data.m_Values = {};
 		data.m_Distribution = nullptr;
+		data.m_Moments = {};
 	}
 	Data::~Data() {
 		delete m_Distribution;
@@ -35,14 +76,19 @@ namespace StatSim {
 		delete m_Distribution;
 
 		m_Data = std::move(data.m_Data);
+		m_MappedFile = std::move(data.m_MappedFile);
+		m_Values = data.m_Values;
 		m_Distribution = data.m_Distribution;
+		m_Moments = data.m_Moments;
 
+		data.m_Values = {};
 		data.m_Distribution = nullptr;
+		data.m_Moments = {};
 		return *this;
 	}
 
-	double Data::operator[](int index) const noexcept {
-		return m_Data[index];
+	double Data::operator[](std::int64_t index) const {
+		return m_Values[index];
 	}
 
 	const Distribution* Data::GetDistribution() const noexcept {
@@ -52,134 +98,772 @@ namespace StatSim {
 		return m_Distribution;
 	}
 
-	int Data::GetSize() const noexcept {
-		return static_cast<int>(m_Data.size());
+	std::int64_t Data::GetSize() const noexcept {
+		return static_cast<std::int64_t>(m_Values.size());
 	}
 	double Data::GetMean() const {
-		return GetSum() / GetSize();
+		return m_Moments.GetMean();
 	}
 	double Data::GetVariance() const {
-		return GetDeviationSum(GetMean()) / GetSize();
+		return m_Moments.GetSquaredDeviationSum() / GetSize();
 	}
 	double Data::GetStandardDeviation() const {
 		return std::sqrt(GetVariance());
 	}
 
-	double Data::GetProbability(double begin, double end) const noexcept {
-		return std::count_if(m_Data.begin(), m_Data.end(), [&](double value) {
-			return begin <= value && value <= end;
-		}) / static_cast<double>(m_Data.size());
+	double Data::GetProbability(double begin, double end) const {
+		if (begin > end) return 0;
+
+		const std::int64_t count = GetRank(end, true) - GetRank(begin, false);
+		return count / static_cast<double>(GetSize());
+	}
+	std::vector<double> Data::GetProbability(const std::vector<Interval>& intervals) const {
+		struct Bound {
+			double Value;
+			bool IsInclusive;
+			std::size_t Slot;
+		};
+
+		std::vector<Bound> bounds;
+		bounds.reserve(intervals.size() * 2);
+		for (std::size_t i = 0; i < intervals.size(); ++i) {
+			bounds.push_back({ intervals[i].GetBegin(), intervals[i].IsBeginOpen(), i * 2 });
+			bounds.push_back({ intervals[i].GetEnd(), !intervals[i].IsEndOpen(), i * 2 + 1 });
+		}
+		std::sort(bounds.begin(), bounds.end(), [](const Bound& a, const Bound& b) {
+			return a.Value < b.Value || (a.Value == b.Value && a.IsInclusive < b.IsInclusive);
+		});
+
+		std::vector<std::int64_t> ranks(bounds.size());
+		std::int64_t rank = 0;
+		for (const auto& bound : bounds) {
+			rank = GetRank(bound.Value, bound.IsInclusive, rank);
+			ranks[bound.Slot] = rank;
+		}
+
+		std::vector<double> result(intervals.size());
+		for (std::size_t i = 0; i < intervals.size(); ++i) {
+			result[i] = (ranks[i * 2 + 1] - ranks[i * 2]) / static_cast<double>(GetSize());
+		}
+		return result;
+	}
+
+	bool Data::IsMapped() const noexcept {
+		return m_MappedFile != nullptr;
 	}
 
-	std::vector<double>::const_iterator Data::begin() const {
-		return m_Data.begin();
+	const double* Data::begin() const noexcept {
+		return m_Values.data();
 	}
-	std::vector<double>::const_iterator Data::end() const {
-		return m_Data.end();
+	const double* Data::end() const noexcept {
+		return m_Values.data() + m_Values.size();
 	}
 
-	double Data::GetSum() const noexcept {
-		return std::accumulate(m_Data.begin(), m_Data.end(), 0.0);
+	std::int64_t Data::GetRank(double value, bool isInclusive, std::int64_t hint) const {
+		const double* const first = begin() + hint;
+		const double* const iter = isInclusive ? std::upper_bound(first, end(), value) : std::lower_bound(first, end(), value);
+		return iter - begin();
 	}
-	double Data::GetDeviationSum(double mean) const noexcept {
-		return std::accumulate(m_Data.begin(), m_Data.end(), 0.0, [&](double sum, double x) {
-			return sum + std::pow(x - mean, 2);
-		});
+	const Moments& Data::GetMoments() const noexcept {
+		return m_Moments;
+	}
+	void Data::SetMoments(const Moments& moments) noexcept {
+		m_Moments = moments;
 	}
 }
 
 namespace StatSim {
-	static std::mt19937 g_Random(std::random_device{}());
-
-	Population::Population(std::vector<double>&& data, Distribution* distribution) noexcept
+	Population::Population(std::vector<double>&& data, Distribution* distribution)
 		: Data(std::move(data), distribution) {}
+	Population::Population(std::vector<double>&& data, Distribution* distribution, const Moments& moments)
+		: Data(std::move(data), distribution, moments) {}
+	Population::Population(std::shared_ptr<const MappedFile> mappedFile, std::span<const double> values, Distribution* distribution, const Moments& moments) noexcept
+		: Data(std::move(mappedFile), values, distribution, moments) {}
 
-	Population::Population(int size, Distribution* distribution)
-		: Data(size, distribution) {}
+	Population::Population(int size, Distribution* distribution, ThreadPool* threadPool)
+		: Data(size, distribution, threadPool) {}
+	Population::Population(Population&& population) noexcept
+		: Data(std::move(population)), m_Samples(std::move(population.m_Samples)), m_SampleGroups(std::move(population.m_SampleGroups)),
+		m_SampleSizes(std::move(population.m_SampleSizes)), m_SampleArena(std::move(population.m_SampleArena)),
+		m_IndexBlocks(std::move(population.m_IndexBlocks)), m_FreeIndexBlocks(std::move(population.m_FreeIndexBlocks)),
+		m_IndexBlockPool(std::move(population.m_IndexBlockPool)), m_OpenIndexBlock(std::exchange(population.m_OpenIndexBlock, -1)),
+		m_OpenIndexBlockUsage(std::exchange(population.m_OpenIndexBlockUsage, 0)), m_SampleRecords(std::move(population.m_SampleRecords)),
+		m_RecentSamples(std::move(population.m_RecentSamples)), m_IndexSize(std::exchange(population.m_IndexSize, 0)),
+		m_MemoryBudget(population.m_MemoryBudget), m_EvictedSampleCount(std::exchange(population.m_EvictedSampleCount, 0)),
+		m_RandomEngine(population.m_RandomEngine), m_RandomStreamCount(population.m_RandomStreamCount) {
+		AdoptSamples();
+	}
 	Population::~Population() {
-		for (auto& [size, samples] : m_Samples) {
-			for (auto* sample : samples) {
-				delete sample;
-			}
+		// 표본은 모두 m_SampleArena에 있으므로, 소멸자만 호출하고 메모리는 한꺼번에 해제합니다.
+		for (auto* sample : m_Samples) {
+			std::destroy_at(sample);
 		}
 	}
 
+	Population& Population::operator=(Population&& population) noexcept {
+		ClearSamples();
+		Data::operator=(std::move(population));
+
+		m_Samples = std::move(population.m_Samples);
+		m_SampleGroups = std::move(population.m_SampleGroups);
+		m_SampleSizes = std::move(population.m_SampleSizes);
+		m_SampleArena = std::move(population.m_SampleArena);
+		m_IndexBlocks = std::move(population.m_IndexBlocks);
+		m_FreeIndexBlocks = std::move(population.m_FreeIndexBlocks);
+		m_IndexBlockPool = std::move(population.m_IndexBlockPool);
+		m_OpenIndexBlock = std::exchange(population.m_OpenIndexBlock, -1);
+		m_OpenIndexBlockUsage = std::exchange(population.m_OpenIndexBlockUsage, 0);
+		m_SampleRecords = std::move(population.m_SampleRecords);
+		m_RecentSamples = std::move(population.m_RecentSamples);
+		m_IndexSize = std::exchange(population.m_IndexSize, 0);
+		m_MemoryBudget = population.m_MemoryBudget;
+		m_EvictedSampleCount = std::exchange(population.m_EvictedSampleCount, 0);
+		m_RandomEngine = population.m_RandomEngine;
+		m_RandomStreamCount = population.m_RandomStreamCount;
+		AdoptSamples();
+		return *this;
+	}
+
 	std::string Population::GetName() const {
-		return "";
+		return "모집단";
 	}
 
 	StatSim::Sample* Population::Sample(int size, bool enableReplacement) {
-		std::vector<double> sample;
-		if (enableReplacement) {
-			std::uniform_int_distribution<> distribution(0, GetSize() - 1);
-			for (int i = 0; i < size; ++i) {
-				sample.push_back(distribution(g_Random));
+		CheckSampleSize(size, enableReplacement);
+
+		StatSim::Sample* const storage = m_SampleArena.Allocate<StatSim::Sample>(1);
+		const auto [indexBlock, indices] = AllocateIndices(static_cast<std::size_t>(size) * GetIndexWidth());
+		const std::uint64_t randomStream = m_RandomStreamCount++;
+		RandomEngine randomEngine = m_RandomEngine.Split(randomStream);
+
+		const int index = GetSampleCount();
+		StatSim::Sample* const sample = DrawSample(storage, index, indices, size, enableReplacement, randomEngine);
+		m_Samples.push_back(sample);
+		m_SampleRecords.push_back({ randomStream, enableReplacement, -1, {} });
+		AttachIndexBlock(index, indexBlock);
+		GetSampleGroup(size).push_back(sample);
+
+		EnforceMemoryBudget(index, index + 1);
+		return sample;
+	}
+	std::vector<StatSim::Sample*> Population::SampleBatch(int size, int count, bool enableReplacement, ThreadPool& threadPool) {
+		assert(count >= 0);
+		CheckSampleSize(size, enableReplacement);
+
+		const std::uint64_t firstStream = m_RandomStreamCount;
+		m_RandomStreamCount += count;
+
+		StatSim::Sample* const storage = m_SampleArena.Allocate<StatSim::Sample>(count);
+
+		// 블록을 만들며 오래된 표본을 제거할 수 있으므로, 표본을 뽑기 전에 인덱스의 자리를 모두 잡아 둡니다.
+		const std::size_t sampleIndexSize = static_cast<std::size_t>(size) * GetIndexWidth();
+		std::vector<int> indexBlocks(count);
+		std::vector<std::byte*> indices(count);
+		for (int i = 0; i < count; ++i) {
+			std::tie(indexBlocks[i], indices[i]) = AllocateIndices(sampleIndexSize);
+		}
+
+		const int firstIndex = GetSampleCount();
+		std::vector<StatSim::Sample*> result(count);
+		threadPool.ParallelFor(count, [&](std::size_t begin, std::size_t end, int) {
+			for (std::size_t i = begin; i < end; ++i) {
+				RandomEngine randomEngine = m_RandomEngine.Split(firstStream + i);
+				result[i] = DrawSample(storage + i, firstIndex + static_cast<int>(i), indices[i], size, enableReplacement, randomEngine);
 			}
-		} else {
-			std::sample(begin(), end(), std::back_inserter(sample), size, g_Random);
+		});
+
+		m_Samples.insert(m_Samples.end(), result.begin(), result.end());
+		for (int i = 0; i < count; ++i) {
+			m_SampleRecords.push_back({ firstStream + i, enableReplacement, -1, {} });
+			AttachIndexBlock(firstIndex + i, indexBlocks[i]);
 		}
 
-		std::sort(sample.begin(), sample.end());
-		return m_Samples[size].emplace_back(new StatSim::Sample(this, m_SampleCount++, std::move(sample), GetDistribution()->Copy()));
+		auto& samples = GetSampleGroup(size);
+		samples.insert(samples.end(), result.begin(), result.end());
+
+		EnforceMemoryBudget(firstIndex, firstIndex + count);
+		return result;
 	}
 	const StatSim::Sample* Population::GetSample(int index) const {
-		return const_cast<Population*>(this)->GetSample(index);
+		if (index < 0 || index >= GetSampleCount()) return nullptr;
+		else return m_Samples[index];
 	}
 	StatSim::Sample* Population::GetSample(int index) {
-		for (auto& [size, samples] : m_Samples) {
-			const auto iter = std::find_if(samples.begin(), samples.end(), [&](const auto* sample) {
-				return sample->GetIndex() == index;
-			});
-			if (iter != samples.end()) return *iter;
+		if (index < 0 || index >= GetSampleCount()) return nullptr;
+
+		const SampleRecord& record = m_SampleRecords[index];
+		if (m_Samples[index]->IsEvicted()) {
+			Restore(index);
+		} else if (record.IndexBlock != -1) {
+			m_RecentSamples.splice(m_RecentSamples.begin(), m_RecentSamples, record.RecentUse);
 		}
-		return nullptr;
+		return m_Samples[index];
 	}
-	std::map<int, std::vector<const StatSim::Sample*>> Population::GetSamples() const {
-		std::map<int, std::vector<const StatSim::Sample*>> result;
-		for (const auto& [size, samples] : m_Samples) {
-			result[size] = { samples.begin(), samples.end() };
-		}
-		return result;
+	std::span<const StatSim::Sample* const> Population::GetSamples() const noexcept {
+		return m_Samples;
 	}
-	std::map<int, std::vector<StatSim::Sample*>> Population::GetSamples() {
+	std::span<StatSim::Sample* const> Population::GetSamples() noexcept {
 		return m_Samples;
 	}
+	std::span<const StatSim::Sample* const> Population::GetSamples(int size) const noexcept {
+		return const_cast<Population*>(this)->GetSamples(size);
+	}
+	std::span<StatSim::Sample* const> Population::GetSamples(int size) noexcept {
+		const auto iter = m_SampleGroups.find(size);
+		if (iter == m_SampleGroups.end()) return {};
+		else return iter->second;
+	}
+	std::size_t Population::GetIndexWidth() const noexcept {
+		return GetSize() > MaxNarrowIndexPopulationSize ? sizeof(std::uint64_t) : sizeof(std::uint32_t);
+	}
+	const std::vector<int>& Population::GetSampleSizes() const noexcept {
+		return m_SampleSizes;
+	}
 	int Population::GetSampleCount() const noexcept {
-		return m_SampleCount;
+		return static_cast<int>(m_Samples.size());
+	}
+	void Population::ClearSamples() noexcept {
+		for (auto* sample : m_Samples) {
+			std::destroy_at(sample);
+		}
+		m_Samples.clear();
+		m_SampleGroups.clear();
+		m_SampleSizes.clear();
+		m_SampleArena.Release();
+		m_IndexBlocks.clear();
+		m_FreeIndexBlocks.clear();
+		m_IndexBlockPool.clear();
+		m_OpenIndexBlock = -1;
+		m_OpenIndexBlockUsage = 0;
+		m_SampleRecords.clear();
+		m_RecentSamples.clear();
+		m_IndexSize = 0;
+		m_EvictedSampleCount = 0;
 	}
 	Population* Population::CreateSampleMeanPopulation(int size) const {
 		std::vector<double> sampleMeans;
-		for (const auto* sample : m_Samples.at(size)) {
+		for (const auto* sample : m_SampleGroups.at(size)) {
 			sampleMeans.push_back(sample->GetMean());
 		}
 
-		std::sort(sampleMeans.begin(), sampleMeans.end());
-		return new Population(std::move(sampleMeans),
-			new NormalDistribution(GetDistribution()->GetMean(), GetDistribution()->GetStandardDeviation() / std::sqrt(size)));
+		SortValues(sampleMeans);
+		return new Population(std::move(sampleMeans), CreateSampleMeanDistribution(size));
 	}
+	Population* Population::CreateSampleMeanPopulation(int size, int count, bool enableReplacement, ThreadPool& threadPool) const {
+		assert(count >= 0);
 
-	Population Population::Load(const std::string& path, DistributionGenerator* distributionGenerator) {
-		std::ifstream file(path);
-		if (!file) throw std::runtime_error("failed to open the file");
+		std::vector<double> sampleMeans(count);
+		ReduceSamples(size, count, enableReplacement, threadPool, [&](std::size_t i, int, const Moments& moments) {
+			sampleMeans[i] = moments.GetMean();
+		});
 
-		std::vector<double> data{ std::istream_iterator<double>(file), std::istream_iterator<double>() };
+		SortValues(sampleMeans, &threadPool);
+		return new Population(std::move(sampleMeans), CreateSampleMeanDistribution(size));
+	}
+	Moments Population::SummarizeSampleMeans(int size, int count, bool enableReplacement, ThreadPool& threadPool) const {
+		assert(count >= 0);
 
-		const double mean = std::accumulate(data.begin(), data.end(), 0.0) / data.size();
-		const double variance = std::accumulate(data.begin(), data.end(), 0.0, [&](double sum, double x) {
-			return sum + std::pow(x - mean, 2);
-		}) / data.size();
-		distributionGenerator->SetParameter("Mean", mean);
-		distributionGenerator->SetParameter("Variance", variance);
+		std::vector<Moments> partialMoments((static_cast<std::size_t>(count) + ReductionBlockSize - 1) / ReductionBlockSize);
+		ReduceSamples(size, count, enableReplacement, threadPool, [&](std::size_t, int block, const Moments& moments) {
+			partialMoments[block].Add(moments.GetMean());
+		});
 
-		return { std::move(data), distributionGenerator->Generate() };
+		Moments result;
+		for (const auto& moments : partialMoments) {
+			result.Merge(moments);
+		}
+		return result;
 	}
-	void Population::Save(const std::string& path) const {
-		std::ofstream file(path);
+
+	std::vector<SampleCoverage> Population::EvaluateCoverage(std::span<const double> k, ThreadPool& threadPool) const {
+		assert(!k.empty());
+		assert(std::ranges::all_of(k, [](double value) { return value > 0; }));
+
+		// 표본마다 |표본평균 - 모평균| / 표준오차를 구하면, 구간의 양 끝이 열려 있으므로 이 값보다 큰 k에서만 구간이 모평균을 포함합니다.
+		// 정렬한 k에서 그 위치를 찾아 세고 누적하면 모든 k의 적중 횟수를 한 번에 얻습니다. 마지막 칸은 어떤 k에서도 빗나간 표본입니다.
+		std::vector<std::size_t> order(k.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::ranges::sort(order, {}, [&](std::size_t i) { return k[i]; });
+		std::vector<double> sortedK(k.size());
+		std::ranges::transform(order, sortedK.begin(), [&](std::size_t i) { return k[i]; });
+
+		const double mean = GetMean();
+		const int threadCount = threadPool.GetThreadCount();
+
+		std::vector<SampleCoverage> result;
+		result.reserve(m_SampleSizes.size());
+		for (const int size : m_SampleSizes) {
+			const auto samples = GetSamples(size);
+			SampleCoverage& coverage = result.emplace_back(SampleCoverage{ size, static_cast<int>(samples.size()), std::vector<double>(k.size()) });
+
+			// 크기가 1인 표본은 표준편차가 0/0이어서 구간을 만들 수 없으므로, 모두 빗나간 것으로 셉니다.
+			if (size == 1) continue;
+
+			const double sizeRoot = std::sqrt(size);
+
+			std::vector<std::vector<std::int64_t>> partialCounts(threadCount, std::vector<std::int64_t>(k.size() + 1));
+			threadPool.ParallelFor(samples.size(), [&](std::size_t begin, std::size_t end, int chunk) {
+				std::vector<std::int64_t>& counts = partialCounts[chunk];
+				for (std::size_t i = begin; i < end; ++i) {
+					// 표준편차가 0이면 구간 (m, m)이 비어 있으므로 모평균을 포함하지 않습니다.
+					const double standardDeviation = samples[i]->GetStandardDeviation();
+					if (standardDeviation == 0) {
+						++counts[k.size()];
+						continue;
+					}
+
+					const double distance = std::abs(samples[i]->GetMean() - mean) * sizeRoot / standardDeviation;
+					++counts[std::ranges::upper_bound(sortedK, distance) - sortedK.begin()];
+				}
+			});
+
+			std::int64_t hitCount = 0;
+			for (std::size_t i = 0; i < k.size(); ++i) {
+				for (const auto& counts : partialCounts) {
+					hitCount += counts[i];
+				}
+				coverage.HitRates[order[i]] = static_cast<double>(hitCount) / samples.size();
+			}
+		}
+		return result;
+	}
+
+	PopulationMemoryUsage Population::GetMemoryUsage() const noexcept {
+		PopulationMemoryUsage result;
+		result.ValueSize = IsMapped() ? 0 : static_cast<std::size_t>(GetSize()) * sizeof(double);
+		// 목록과 해시 테이블의 노드 크기는 구현마다 다르므로 대략적인 값입니다.
+		result.SampleSize = m_SampleArena.GetReservedSize() + m_Samples.capacity() * sizeof(StatSim::Sample*) * 2 +
+			m_SampleRecords.capacity() * sizeof(SampleRecord) + m_RecentSamples.size() * (sizeof(int) + sizeof(void*) * 2) +
+			m_IndexBlocks.capacity() * sizeof(IndexBlock) + m_FreeIndexBlocks.capacity() * sizeof(int) +
+			m_IndexBlockPool.capacity() * sizeof(std::unique_ptr<std::byte[]>);
+		result.IndexSize = m_IndexSize;
+		result.TotalSize = result.ValueSize + result.SampleSize + result.IndexSize;
+		result.EvictedSampleCount = m_EvictedSampleCount;
+		return result;
+	}
+	std::size_t Population::GetMemoryBudget() const noexcept {
+		return m_MemoryBudget;
+	}
+	void Population::SetMemoryBudget(std::size_t budget) {
+		m_MemoryBudget = budget;
+		EnforceMemoryBudget();
+	}
+
+	Population Population::Load(const std::string& path, DistributionGenerator* distributionGenerator, ThreadPool& threadPool) {
+		const MappedFile file(path);
+		const char* const text = reinterpret_cast<const char*>(file.GetData());
+		const std::size_t textSize = file.GetSize();
+
+		const auto isSpace = [](char c) {
+			return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+		};
+
+		// 파일을 스레드 수만큼 나누되, 수가 잘리지 않도록 각 경계를 다음 공백까지 밉니다.
+		const std::size_t chunkCount = static_cast<std::size_t>(threadPool.GetThreadCount());
+		std::vector<std::size_t> boundaries(chunkCount + 1, textSize);
+		boundaries[0] = 0;
+		for (std::size_t i = 1; i < chunkCount; ++i) {
+			std::size_t boundary = std::max(textSize / chunkCount * i, boundaries[i - 1]);
+			while (boundary < textSize && !isSpace(text[boundary])) {
+				++boundary;
+			}
+			boundaries[i] = boundary;
+		}
+
+		std::vector<std::vector<double>> chunkData(chunkCount);
+		std::vector<Moments> chunkMoments(chunkCount);
+		threadPool.ParallelFor(chunkCount, [&](std::size_t begin, std::size_t end, int) {
+			for (std::size_t chunk = begin; chunk < end; ++chunk) {
+				const char* first = text + boundaries[chunk];
+				const char* const last = text + boundaries[chunk + 1];
+				auto& values = chunkData[chunk];
+				values.reserve((last - first) / 8);
+
+				while (true) {
+					while (first != last && isSpace(*first)) {
+						++first;
+					}
+					if (first == last) break;
+
+					double value;
+					const auto [next, error] = std::from_chars(first, last, value);
+					if (error != std::errc() || (next != last && !isSpace(*next))) throw std::runtime_error("invalid population file");
+
+					values.push_back(value);
+					chunkMoments[chunk].Add(value);
+					first = next;
+				}
+			}
+		});
+
+		std::vector<std::size_t> offsets(chunkCount + 1);
+		Moments moments;
+		for (std::size_t i = 0; i < chunkCount; ++i) {
+			offsets[i + 1] = offsets[i] + chunkData[i].size();
+			moments.Merge(chunkMoments[i]);
+		}
+
+		std::vector<double> data(offsets.back());
+		threadPool.ParallelFor(chunkCount, [&](std::size_t begin, std::size_t end, int) {
+			for (std::size_t chunk = begin; chunk < end; ++chunk) {
+				std::copy(chunkData[chunk].begin(), chunkData[chunk].end(), data.begin() + offsets[chunk]);
+				std::vector<double>().swap(chunkData[chunk]);
+			}
+		});
+
+		SortValues(data, &threadPool);
+
+		distributionGenerator->SetParameter("Mean", moments.GetMean());
+		distributionGenerator->SetParameter("Variance", moments.GetSquaredDeviationSum() / data.size());
+
+		return { std::move(data), distributionGenerator->Generate(), moments };
+	}
+	Population Population::LoadBinary(const std::string& path, DistributionGenerator* distributionGenerator) {
+		if constexpr (std::endian::native != std::endian::little) throw std::runtime_error("unsupported byte order");
+
+		auto file = std::make_shared<const MappedFile>(path);
+		if (file->GetSize() < sizeof(PopulationFileHeader)) throw std::runtime_error("invalid population file");
+
+		PopulationFileHeader header;
+		std::memcpy(&header, file->GetData(), sizeof(header));
+		if (std::memcmp(header.Magic, PopulationFileHeader::MagicValue, sizeof(header.Magic)) != 0) throw std::runtime_error("invalid population file");
+		else if (header.Version != PopulationFileHeader::CurrentVersion) throw std::runtime_error("unsupported population file version");
+		else if (header.Size > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) / sizeof(double) ||
+			file->GetSize() != sizeof(header) + header.Size * sizeof(double)) throw std::runtime_error("invalid population file");
+
+		Distribution* distribution = nullptr;
+		switch (header.DistributionType) {
+		case PopulationFileHeader::BinomialDistributionType:
+			distribution = new BinomialDistribution(static_cast<int>(header.DistributionParameters[0]), header.DistributionParameters[1]);
+			break;
+
+		case PopulationFileHeader::NormalDistributionType:
+			distribution = new NormalDistribution(header.DistributionParameters[0], header.DistributionParameters[1]);
+			break;
+
+		default:
+			if (distributionGenerator == nullptr) throw std::runtime_error("unknown distribution");
+
+			distributionGenerator->SetParameter("Mean", header.Mean);
+			distributionGenerator->SetParameter("Variance", header.SquaredDeviationSum / header.Size);
+			distribution = distributionGenerator->Generate();
+			break;
+		}
+
+		const Moments moments(static_cast<std::int64_t>(header.Size), header.Mean, header.SquaredDeviationSum);
+		const std::span<const double> values(reinterpret_cast<const double*>(file->GetData() + sizeof(header)), header.Size);
+		if (header.Flags & PopulationFileHeader::SortedFlag) return { std::move(file), values, distribution, moments };
+		else return { std::vector<double>(values.begin(), values.end()), distribution, moments };
+	}
+	void Population::Save(const std::string& path, ThreadPool* threadPool) const {
+		std::ofstream file(path, std::ios::binary);
+		if (!file) throw std::runtime_error("failed to open the file");
+
+		DataWriter(file, '\n', std::nullopt, threadPool).Write(*this);
+		if (!file) throw std::runtime_error("failed to write the file");
+	}
+	void Population::SaveBinary(const std::string& path) const {
+		if constexpr (std::endian::native != std::endian::little) throw std::runtime_error("unsupported byte order");
+
+		std::ofstream file(path, std::ios::binary);
 		if (!file) throw std::runtime_error("failed to open the file");
 
-		for (int i = 0; i < GetSize(); ++i) {
-			file << (*this)[i] << '\n';
+		const PopulationFileHeader header = PopulationFileHeader::Create(GetDistribution(), GetMoments());
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(begin()), static_cast<std::streamsize>(GetSize() * sizeof(double)));
+		if (!file) throw std::runtime_error("failed to write the file");
+	}
+
+	void Population::GenerateBinary(const std::string& path, std::uint64_t size, Distribution* distribution, ThreadPool& threadPool, std::size_t memoryBudget) {
+		PopulationFileWriter writer(path, memoryBudget, &threadPool);
+
+		std::vector<double> block(std::min<std::uint64_t>(size, PopulationFileWriter::MinRunSize));
+		for (std::uint64_t remaining = size; remaining > 0;) {
+			const std::span<double> values(block.data(), static_cast<std::size_t>(std::min<std::uint64_t>(remaining, block.size())));
+			distribution->Generate(values);
+			writer.Write(values);
+			remaining -= values.size();
+		}
+		writer.Finish(distribution);
+	}
+	void Population::ConvertToBinary(const std::string& textPath, const std::string& binaryPath, DistributionGenerator* distributionGenerator,
+		ThreadPool& threadPool, std::size_t memoryBudget) {
+		const MappedFile file(textPath);
+		const char* first = reinterpret_cast<const char*>(file.GetData());
+		const char* const last = first + file.GetSize();
+
+		const auto isSpace = [](char c) {
+			return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+		};
+
+		// 텍스트 파일도 mmap으로 앞에서부터 한 번만 읽으므로, 이미 읽은 페이지는 운영체제가 언제든 내보낼 수 있습니다.
+		PopulationFileWriter writer(binaryPath, memoryBudget, &threadPool);
+		std::vector<double> block;
+		block.reserve(PopulationFileWriter::MinRunSize);
+		while (true) {
+			while (first != last && isSpace(*first)) {
+				++first;
+			}
+			if (first == last) break;
+
+			double value;
+			const auto [next, error] = std::from_chars(first, last, value);
+			if (error != std::errc() || (next != last && !isSpace(*next))) throw std::runtime_error("invalid population file");
+
+			block.push_back(value);
+			if (block.size() == PopulationFileWriter::MinRunSize) {
+				writer.Write(block);
+				block.clear();
+			}
+			first = next;
+		}
+		writer.Write(block);
+		writer.Finish(distributionGenerator);
+	}
+
+	template<typename T>
+	void Population::DrawIndices(T* indices, int size, bool enableReplacement, RandomEngine& randomEngine) const {
+		CheckSampleSize(size, enableReplacement);
+
+		// 뽑는 방법은 T와 무관하므로, 같은 스트림이면 인덱스의 너비와 관계없이 같은 표본이 나옵니다.
+		if (enableReplacement) {
+			std::uniform_int_distribution<std::uint64_t> distribution(0, GetSize() - 1);
+			std::generate_n(indices, size, [&]() {
+				return static_cast<T>(distribution(randomEngine));
+			});
+			std::sort(indices, indices + size);
+		} else if (static_cast<std::int64_t>(size) * FloydSamplingRatio < GetSize()) {
+			// Floyd의 방법: 뽑은 인덱스를 열린 주소법 해시 집합으로 확인하므로 모집단 크기와 무관하게 O(size)입니다.
+			thread_local std::vector<std::uint64_t> table;
+			const std::size_t tableSize = std::bit_ceil(static_cast<std::size_t>(size) * 2);
+			const std::size_t mask = tableSize - 1;
+			table.assign(tableSize, UINT64_MAX);
+
+			const auto insert = [&](std::uint64_t index) {
+				std::size_t slot = static_cast<std::size_t>(index * 0x9E3779B97F4A7C15u >> 32) & mask;
+				while (table[slot] != UINT64_MAX) {
+					if (table[slot] == index) return false;
+					slot = (slot + 1) & mask;
+				}
+				table[slot] = index;
+				return true;
+			};
+
+			std::uniform_int_distribution<std::uint64_t> distribution;
+			using Range = std::uniform_int_distribution<std::uint64_t>::param_type;
+			std::int64_t j = GetSize() - size;
+			for (int i = 0; i < size; ++i, ++j) {
+				std::uint64_t index = distribution(randomEngine, Range(0, static_cast<std::uint64_t>(j)));
+				if (!insert(index)) {
+					// 이미 뽑힌 값이면 j를 씁니다. j는 아직 뽑힐 수 없었으므로 항상 새 값입니다.
+					index = static_cast<std::uint64_t>(j);
+					insert(index);
+				}
+				indices[i] = static_cast<T>(index);
+			}
+			std::sort(indices, indices + size);
+		} else {
+			// 선택 표집: 인덱스를 오름차순으로 훑으므로 결과가 이미 정렬되어 있습니다.
+			std::uniform_real_distribution<> distribution;
+			int needed = size;
+			for (std::int64_t i = 0, remaining = GetSize(); needed > 0; ++i, --remaining) {
+				if (distribution(randomEngine) * remaining < needed) {
+					indices[size - needed--] = static_cast<T>(i);
+				}
+			}
+		}
+	}
+	void Population::CheckSampleSize(int size, bool enableReplacement) const {
+		// 비복원 추출에서 모집단보다 큰 표본을 뽑으면 선택 표집은 범위를 넘고 Floyd의 방법은 끝나지 않습니다.
+		if (size < 0 || (size > 0 && GetSize() == 0) || (!enableReplacement && size > GetSize())) {
+			throw std::invalid_argument("invalid sample size");
+		}
+	}
+	template<typename T>
+	StatSim::Sample* Population::CreateSample(StatSim::Sample* storage, int index, const T* indices, int size) {
+		const bool isContiguous = size > 0 && std::adjacent_find(indices, indices + size, [](T a, T b) {
+			return b != a + 1;
+		}) == indices + size;
+		if (isContiguous) return std::construct_at(storage, this, index, static_cast<std::int64_t>(indices[0]), size);
+		else return std::construct_at(storage, this, index, indices, size);
+	}
+	StatSim::Sample* Population::DrawSample(StatSim::Sample* storage, int index, std::byte* indices, int size, bool enableReplacement,
+		RandomEngine& randomEngine) {
+		const auto draw = [&]<typename T>(T* typedIndices) {
+			DrawIndices(typedIndices, size, enableReplacement, randomEngine);
+			return CreateSample(storage, index, typedIndices, size);
+		};
+		if (GetIndexWidth() == sizeof(std::uint64_t)) return draw(reinterpret_cast<std::uint64_t*>(indices));
+		else return draw(reinterpret_cast<std::uint32_t*>(indices));
+	}
+	std::pair<int, std::byte*> Population::AllocateIndices(std::size_t size) {
+		if (size > IndexBlockSize) {
+			const int indexBlock = CreateIndexBlock(size);
+			IndexBlock& block = m_IndexBlocks[indexBlock];
+			++block.SampleCount;
+			return { indexBlock, block.Indices.get() };
+		}
+
+		if (m_OpenIndexBlock == -1 || m_OpenIndexBlockUsage + size > IndexBlockSize) {
+			const int closedBlock = std::exchange(m_OpenIndexBlock, -1);
+			if (closedBlock != -1) {
+				ReleaseIndexBlock(closedBlock);
+			}
+			m_OpenIndexBlock = CreateIndexBlock(IndexBlockSize);
+			m_OpenIndexBlockUsage = 0;
+		}
+
+		IndexBlock& block = m_IndexBlocks[m_OpenIndexBlock];
+		std::byte* const indices = block.Indices.get() + m_OpenIndexBlockUsage;
+		m_OpenIndexBlockUsage += size;
+		++block.SampleCount;
+		return { m_OpenIndexBlock, indices };
+	}
+	int Population::CreateIndexBlock(std::size_t size) {
+		// 새로 할당하기 전에 예산에 맞춰 오래된 표본을 제거하면, 그렇게 비워진 블록을 풀에서 곧바로 다시 씁니다.
+		while (!m_RecentSamples.empty() && GetMemoryUsage().TotalSize - m_IndexBlockPool.size() * IndexBlockSize + size > m_MemoryBudget) {
+			Evict(m_RecentSamples.back());
+		}
+
+		// ReleaseIndexBlock이 할당 없이 블록을 돌려줄 수 있도록 미리 공간을 잡아 둡니다.
+		m_FreeIndexBlocks.reserve(m_IndexBlocks.size() + 1);
+		m_IndexBlockPool.reserve(m_IndexBlocks.size() + 1);
+		int indexBlock;
+		if (m_FreeIndexBlocks.empty()) {
+			m_IndexBlocks.push_back({ nullptr, 0, 0 });
+			indexBlock = static_cast<int>(m_IndexBlocks.size() - 1);
+		} else {
+			indexBlock = m_FreeIndexBlocks.back();
+			m_FreeIndexBlocks.pop_back();
+		}
+
+		IndexBlock& block = m_IndexBlocks[indexBlock];
+		if (size == IndexBlockSize && !m_IndexBlockPool.empty()) {
+			block.Indices = std::move(m_IndexBlockPool.back());
+			m_IndexBlockPool.pop_back();
+		} else {
+			try {
+				block.Indices.reset(new std::byte[size]);
+			} catch (...) {
+				m_FreeIndexBlocks.push_back(indexBlock);
+				throw;
+			}
+			m_IndexSize += size;
+		}
+		block.Size = size;
+		block.SampleCount = 0;
+		return indexBlock;
+	}
+	void Population::AttachIndexBlock(int index, int indexBlock) {
+		// 연속한 구간을 가리키는 표본은 인덱스를 쓰지 않으므로, 잡아 둔 자리를 바로 돌려줍니다.
+		if (m_Samples[index]->GetIndices() == nullptr && m_Samples[index]->GetWideIndices() == nullptr) {
+			--m_IndexBlocks[indexBlock].SampleCount;
+			ReleaseIndexBlock(indexBlock);
+			return;
+		}
+
+		SampleRecord& record = m_SampleRecords[index];
+		record.IndexBlock = indexBlock;
+		m_RecentSamples.push_front(index);
+		record.RecentUse = m_RecentSamples.begin();
+	}
+	void Population::ReleaseIndexBlock(int indexBlock) noexcept {
+		// 아직 자르고 있는 블록은 표본이 없어도 남겨 둡니다.
+		IndexBlock& block = m_IndexBlocks[indexBlock];
+		if (block.SampleCount > 0 || block.Indices == nullptr || indexBlock == m_OpenIndexBlock) return;
+
+		if (block.Size == IndexBlockSize) {
+			m_IndexBlockPool.push_back(std::move(block.Indices));
+		} else {
+			block.Indices.reset();
+			m_IndexSize -= block.Size;
 		}
+		m_FreeIndexBlocks.push_back(indexBlock);
+	}
+	void Population::AdoptSamples() noexcept {
+		for (auto* sample : m_Samples) {
+			sample->m_Population = this;
+		}
+	}
+	void Population::Evict(int index) noexcept {
+		SampleRecord& record = m_SampleRecords[index];
+		assert(record.IndexBlock != -1);
+
+		m_Samples[index]->Evict();
+		m_RecentSamples.erase(record.RecentUse);
+		--m_IndexBlocks[record.IndexBlock].SampleCount;
+		ReleaseIndexBlock(record.IndexBlock);
+		record.IndexBlock = -1;
+		++m_EvictedSampleCount;
+	}
+	void Population::Restore(int index) {
+		StatSim::Sample* const sample = m_Samples[index];
+		const SampleRecord& record = m_SampleRecords[index];
+		const int size = static_cast<int>(sample->GetSize());
+
+		const auto [indexBlock, indices] = AllocateIndices(static_cast<std::size_t>(size) * GetIndexWidth());
+		RandomEngine randomEngine = m_RandomEngine.Split(record.RandomStream);
+
+		// 같은 자리에 다시 만들어 표본을 가리키는 포인터가 그대로 유효하게 합니다.
+		std::destroy_at(sample);
+		DrawSample(sample, index, indices, size, record.EnableReplacement, randomEngine);
+		AttachIndexBlock(index, indexBlock);
+		--m_EvictedSampleCount;
+
+		EnforceMemoryBudget(index, index + 1);
+	}
+	void Population::EnforceMemoryBudget(int keptBegin, int keptEnd) noexcept {
+		// 다시 쓰려고 남겨 둔 블록을 먼저 해제하고, 그래도 넘으면 표본을 제거합니다. 표본을 제거해 비워진 블록도 풀에 들어갑니다.
+		// 지킬 표본은 방금 만들거나 복원해 목록의 앞쪽에 모여 있으므로, 뒤에서부터 제거하다 만나면 멈춥니다.
+		while (GetMemoryUsage().TotalSize > m_MemoryBudget) {
+			if (!m_IndexBlockPool.empty()) {
+				m_IndexBlockPool.pop_back();
+				m_IndexSize -= IndexBlockSize;
+				continue;
+			}
+			if (m_RecentSamples.empty()) break;
+
+			const int index = m_RecentSamples.back();
+			if (keptBegin <= index && index < keptEnd) break;
+
+			Evict(index);
+		}
+	}
+	Distribution* Population::CreateSampleMeanDistribution(int size) const {
+		return new NormalDistribution(GetDistribution()->GetMean(), GetDistribution()->GetStandardDeviation() / std::sqrt(size));
+	}
+	template<typename F>
+	void Population::ReduceSamples(int size, int count, bool enableReplacement, ThreadPool& threadPool, F&& function) const {
+		assert(size >= 1);
+		CheckSampleSize(size, enableReplacement);
+
+		const std::uint64_t firstStream = m_RandomStreamCount;
+		m_RandomStreamCount += count;
+
+		// 표본을 만들지 않고 인덱스를 뽑은 즉시 모멘트로 줄인 뒤 버리므로, 메모리 사용량이 반복 횟수와 무관합니다.
+		// 반복을 스레드 수와 무관한 크기의 블록으로 나눠 function에 블록 번호를 넘기므로, 블록별로 합치면 결과가 항상 같습니다.
+		const std::size_t blockCount = (static_cast<std::size_t>(count) + ReductionBlockSize - 1) / ReductionBlockSize;
+		threadPool.ParallelFor(blockCount, [&](std::size_t firstBlock, std::size_t lastBlock, int) {
+			std::vector<std::uint64_t> indices(size);
+			const std::size_t end = std::min(lastBlock * ReductionBlockSize, static_cast<std::size_t>(count));
+			for (std::size_t i = firstBlock * ReductionBlockSize; i < end; ++i) {
+				RandomEngine randomEngine = m_RandomEngine.Split(firstStream + i);
+				DrawIndices(indices.data(), size, enableReplacement, randomEngine);
+
+				Moments moments;
+				for (const std::uint64_t index : indices) {
+					moments.Add((*this)[index]);
+				}
+				function(i, static_cast<int>(i / ReductionBlockSize), moments);
+			}
+		});
+	}
+	std::vector<StatSim::Sample*>& Population::GetSampleGroup(int size) {
+		const auto [iter, isInserted] = m_SampleGroups.try_emplace(size);
+		if (isInserted) {
+			m_SampleSizes.insert(std::upper_bound(m_SampleSizes.begin(), m_SampleSizes.end(), size), size);
+		}
+		return iter->second;
 	}
 }
 
@@ -188,9 +872,67 @@ namespace StatSim {
 		: Data(std::move(data), distribution), m_Population(population), m_Index(index) {
 		assert(index >= 0);
 	}
+	Sample::Sample(Population* population, int index, const std::uint32_t* indices, int size) noexcept
+		: Data(std::vector<double>(), nullptr), m_Population(population), m_Index(index), m_Indices(indices), m_ViewSize(size), m_IsView(true) {
+		assert(population != nullptr);
+		assert(index >= 0);
+
+		UpdateMoments();
+	}
+	Sample::Sample(Population* population, int index, const std::uint64_t* indices, int size) noexcept
+		: Data(std::vector<double>(), nullptr), m_Population(population), m_Index(index), m_WideIndices(indices), m_ViewSize(size), m_IsView(true) {
+		assert(population != nullptr);
+		assert(index >= 0);
+
+		UpdateMoments();
+	}
+	Sample::Sample(Population* population, int index, std::int64_t rangeBegin, int rangeSize) noexcept
+		: Data(std::vector<double>(), nullptr), m_Population(population), m_Index(index), m_RangeBegin(rangeBegin), m_ViewSize(rangeSize), m_IsView(true) {
+		assert(population != nullptr);
+		assert(index >= 0);
+		assert(rangeBegin >= 0 && rangeSize >= 0 && rangeBegin + rangeSize <= population->GetSize());
+
+		UpdateMoments();
+	}
+
+	template<typename F>
+	void Sample::ForEach(F&& function) const {
+		assert(!m_IsEvicted);
+
+		const Population& population = *m_Population;
+		if (m_Indices != nullptr) {
+			for (int i = 0; i < m_ViewSize; ++i) {
+				function(population[m_Indices[i]]);
+			}
+		} else if (m_WideIndices != nullptr) {
+			for (int i = 0; i < m_ViewSize; ++i) {
+				function(population[m_WideIndices[i]]);
+			}
+		} else {
+			for (std::int64_t i = m_RangeBegin; i < m_RangeBegin + m_ViewSize; ++i) {
+				function(population[i]);
+			}
+		}
+	}
+
+	double Sample::operator[](std::int64_t index) const {
+		CheckEvicted();
+
+		if (!m_IsView) return Data::operator[](index);
+		else if (m_Indices != nullptr) return (*m_Population)[m_Indices[index]];
+		else if (m_WideIndices != nullptr) return (*m_Population)[m_WideIndices[index]];
+		else return (*m_Population)[m_RangeBegin + index];
+	}
 
 	std::string Sample::GetName() const {
-		return "ǥ #" + std::to_string(m_Index);
+		return "표본 #" + std::to_string(m_Index);
+	}
+	const Distribution* Sample::GetDistribution() const noexcept {
+		return const_cast<Sample*>(this)->GetDistribution();
+	}
+	Distribution* Sample::GetDistribution() noexcept {
+		if (!m_IsView) return Data::GetDistribution();
+		else return m_Population->GetDistribution();
 	}
 	const Population* Sample::GetPopulation() const noexcept {
 		return m_Population;
@@ -201,11 +943,35 @@ namespace StatSim {
 	int Sample::GetIndex() const noexcept {
 		return m_Index;
 	}
+	bool Sample::IsView() const noexcept {
+		return m_IsView;
+	}
+	const std::uint32_t* Sample::GetIndices() const noexcept {
+		return m_Indices;
+	}
+	const std::uint64_t* Sample::GetWideIndices() const noexcept {
+		return m_WideIndices;
+	}
+	bool Sample::IsEvicted() const noexcept {
+		return m_IsEvicted;
+	}
+	void Sample::Evict() noexcept {
+		assert(m_IsView);
+
+		m_Indices = nullptr;
+		m_WideIndices = nullptr;
+		m_IsEvicted = true;
+	}
 
+	std::int64_t Sample::GetSize() const noexcept {
+		if (!m_IsView) return Data::GetSize();
+		else return m_ViewSize;
+	}
 	double Sample::GetVariance() const {
-		return GetDeviationSum(GetMean()) / (GetSize() - 1);
+		return GetMoments().GetSquaredDeviationSum() / (GetSize() - 1);
 	}
 
+
 	std::pair<Interval, double> Sample::GetConfidenceLevel(double k) const {
 		assert(k > 0);
 
@@ -217,4 +983,235 @@ namespace StatSim {
 		const double c = k * GetStandardDeviation() / std::sqrt(GetSize());
 		return { { m - c, false, m + c, false }, cdf(k) - cdf(-k) };
 	}
+	BootstrapInterval Sample::Bootstrap(BootstrapStatistic statistic, int replicateCount, double confidence, ThreadPool& threadPool) const {
+		assert(replicateCount >= 2);
+		assert(0 < confidence && confidence < 1);
+
+		const int size = static_cast<int>(GetSize());
+		assert(size >= 3);
+
+		// 표본은 정렬되어 있으므로, 중앙값은 원소마다 뽑힌 횟수를 센 뒤 앞에서부터 누적해 구합니다.
+		// 분산은 표본평균을 뺀 값으로 계산해 상쇄 오차를 줄입니다.
+		const double mean = GetMean();
+		std::vector<double> values(size);
+		for (int i = 0; i < size; ++i) {
+			values[i] = statistic == BootstrapStatistic::Variance ? (*this)[i] - mean : (*this)[i];
+		}
+
+		const auto getMedian = [&](const auto& getValue, int count) {
+			return (getValue((count - 1) / 2) + getValue(count / 2)) / 2;
+		};
+
+		double estimate;
+		switch (statistic) {
+		case BootstrapStatistic::Mean: estimate = mean; break;
+		case BootstrapStatistic::Median: estimate = getMedian([&](int i) { return values[i]; }, size); break;
+		case BootstrapStatistic::Variance: estimate = GetVariance(); break;
+		default: throw std::runtime_error("unknown bootstrap statistic");
+		}
+
+		std::vector<double> replicates(replicateCount);
+		const RandomEngine randomEngine = CreateRandomEngine();
+		threadPool.ParallelFor(replicateCount, [&](std::size_t begin, std::size_t end, int) {
+			// 버퍼는 구간마다 한 번만 만들고 재표본 사이에서 다시 씁니다.
+			std::vector<std::uint64_t> bits((size + 1) / 2);
+			std::vector<std::uint32_t> indices(size);
+			std::vector<std::uint32_t> counts(statistic == BootstrapStatistic::Median ? size : 0);
+
+			// 64비트 난수 하나에서 인덱스를 두 개 만듭니다. Lemire의 방법으로 곱의 하위 32비트가 threshold보다 작으면 다시 뽑으므로 치우침이 없습니다.
+			const std::uint32_t threshold = (0u - static_cast<std::uint32_t>(size)) % static_cast<std::uint32_t>(size);
+			const auto getIndex = [size](std::uint32_t value) {
+				return static_cast<std::uint64_t>(value) * static_cast<std::uint32_t>(size);
+			};
+
+			for (std::size_t r = begin; r < end; ++r) {
+				RandomEngine engine = randomEngine.Split(r);
+				engine.Fill(bits);
+
+				bool isRejected = false;
+				for (int i = 0; i < size; ++i) {
+					const std::uint64_t product = getIndex(static_cast<std::uint32_t>(bits[i / 2] >> (i % 2 * 32)));
+					indices[i] = static_cast<std::uint32_t>(product >> 32);
+					isRejected |= static_cast<std::uint32_t>(product) < threshold;
+				}
+				if (isRejected) {
+					for (int i = 0; i < size; ++i) {
+						std::uint64_t product = getIndex(static_cast<std::uint32_t>(bits[i / 2] >> (i % 2 * 32)));
+						while (static_cast<std::uint32_t>(product) < threshold) {
+							product = getIndex(static_cast<std::uint32_t>(engine()));
+						}
+						indices[i] = static_cast<std::uint32_t>(product >> 32);
+					}
+				}
+
+				double result;
+				switch (statistic) {
+				case BootstrapStatistic::Mean: {
+					double sum[4]{};
+					int i = 0;
+					for (; i + 4 <= size; i += 4) {
+						for (int j = 0; j < 4; ++j) {
+							sum[j] += values[indices[i + j]];
+						}
+					}
+					for (; i < size; ++i) {
+						sum[0] += values[indices[i]];
+					}
+					result = ((sum[0] + sum[1]) + (sum[2] + sum[3])) / size;
+					break;
+				}
+
+				case BootstrapStatistic::Median: {
+					std::fill(counts.begin(), counts.end(), 0);
+					for (int i = 0; i < size; ++i) {
+						++counts[indices[i]];
+					}
+
+					const int lowerRank = (size - 1) / 2, upperRank = size / 2;
+					int i = 0, cumulativeCount = counts[0];
+					while (cumulativeCount <= lowerRank) {
+						cumulativeCount += counts[++i];
+					}
+					const double lower = values[i];
+					while (cumulativeCount <= upperRank) {
+						cumulativeCount += counts[++i];
+					}
+					result = (lower + values[i]) / 2;
+					break;
+				}
+
+				case BootstrapStatistic::Variance: {
+					double sum[4]{}, squaredSum[4]{};
+					int i = 0;
+					for (; i + 4 <= size; i += 4) {
+						for (int j = 0; j < 4; ++j) {
+							const double value = values[indices[i + j]];
+							sum[j] += value;
+							squaredSum[j] += value * value;
+						}
+					}
+					for (; i < size; ++i) {
+						const double value = values[indices[i]];
+						sum[0] += value;
+						squaredSum[0] += value * value;
+					}
+
+					const double totalSum = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+					const double totalSquaredSum = (squaredSum[0] + squaredSum[1]) + (squaredSum[2] + squaredSum[3]);
+					result = (totalSquaredSum - totalSum * totalSum / size) / (size - 1);
+					break;
+				}
+
+				default: throw std::runtime_error("unknown bootstrap statistic");
+				}
+				replicates[r] = result;
+			}
+		});
+
+		// 잭나이프: 원소를 하나씩 뺀 통계량을 닫힌 형태로 구해 가속 상수를 계산합니다.
+		std::vector<double> jackknife(size);
+		double valueSum = 0, squaredValueSum = 0;
+		for (const double value : values) {
+			valueSum += value;
+			squaredValueSum += value * value;
+		}
+		for (int i = 0; i < size; ++i) {
+			switch (statistic) {
+			case BootstrapStatistic::Mean:
+				jackknife[i] = (valueSum - values[i]) / (size - 1);
+				break;
+
+			case BootstrapStatistic::Median:
+				jackknife[i] = getMedian([&](int j) { return values[j < i ? j : j + 1]; }, size - 1);
+				break;
+
+			case BootstrapStatistic::Variance: {
+				const double sum = valueSum - values[i], squaredSum = squaredValueSum - values[i] * values[i];
+				jackknife[i] = (squaredSum - sum * sum / (size - 1)) / (size - 2);
+				break;
+			}
+			}
+		}
+
+		const double jackknifeMean = std::accumulate(jackknife.begin(), jackknife.end(), 0.0) / size;
+		double squaredDeviationSum = 0, cubedDeviationSum = 0;
+		for (const double value : jackknife) {
+			const double deviation = jackknifeMean - value;
+			squaredDeviationSum += deviation * deviation;
+			cubedDeviationSum += deviation * deviation * deviation;
+		}
+		const double acceleration = squaredDeviationSum > 0 ? cubedDeviationSum / (6 * std::pow(squaredDeviationSum, 1.5)) : 0;
+
+		SortValues(replicates, &threadPool);
+
+		Moments replicateMoments;
+		for (const double value : replicates) {
+			replicateMoments.Add(value);
+		}
+
+		const auto getQuantile = [&](double probability) {
+			const double position = std::clamp(probability, 0.0, 1.0) * (replicateCount - 1);
+			const int index = std::min(static_cast<int>(position), replicateCount - 2);
+			const double fraction = position - index;
+			return replicates[index] + (replicates[index + 1] - replicates[index]) * fraction;
+		};
+
+		// 편향 보정 상수 z0는 추정값보다 작은 재표본 통계량의 비율에서 구하고, 같은 값은 절반씩 셉니다.
+		const auto lower = std::lower_bound(replicates.begin(), replicates.end(), estimate);
+		const auto upper = std::upper_bound(lower, replicates.end(), estimate);
+		const double proportion = std::clamp(((lower - replicates.begin()) + (upper - lower) / 2.0) / replicateCount,
+			0.5 / replicateCount, 1 - 0.5 / replicateCount);
+		const double z0 = NormalICDF(proportion, 0, 1);
+
+		const double alpha = (1 - confidence) / 2;
+		const auto getBCaQuantile = [&](double probability) {
+			const double z = z0 + NormalICDF(probability, 0, 1);
+			const double denominator = 1 - acceleration * z;
+			if (denominator <= 0) return getQuantile(z > 0 ? 1 : 0);
+			return getQuantile(NormalCDF(z0 + z / denominator, 0, 1));
+		};
+
+		return {
+			estimate,
+			std::sqrt(replicateMoments.GetSquaredDeviationSum() / (replicateCount - 1)),
+			{ getQuantile(alpha), false, getQuantile(1 - alpha), false },
+			{ getBCaQuantile(alpha), false, getBCaQuantile(1 - alpha), false },
+		};
+	}
+
+	std::int64_t Sample::GetRank(double value, bool isInclusive, std::int64_t hint) const {
+		CheckEvicted();
+
+		if (!m_IsView) return Data::GetRank(value, isInclusive, hint);
+		else if (m_Indices == nullptr && m_WideIndices == nullptr) {
+			const std::int64_t rank = m_Population->GetRank(value, isInclusive, m_RangeBegin + hint);
+			return std::clamp<std::int64_t>(rank - m_RangeBegin, hint, m_ViewSize);
+		}
+
+		const Population& population = *m_Population;
+		const auto getRank = [&](const auto* indices) -> std::int64_t {
+			const auto projection = [&](std::uint64_t index) {
+				return population[index];
+			};
+			const auto* const first = indices + hint;
+			const auto* const last = indices + m_ViewSize;
+			const auto iter = isInclusive ? std::ranges::upper_bound(first, last, value, {}, projection) :
+				std::ranges::lower_bound(first, last, value, {}, projection);
+			return iter - indices;
+		};
+		if (m_Indices != nullptr) return getRank(m_Indices);
+		else return getRank(m_WideIndices);
+	}
+
+	void Sample::UpdateMoments() noexcept {
+		Moments moments;
+		ForEach([&](double value) {
+			moments.Add(value);
+		});
+		SetMoments(moments);
+	}
+	void Sample::CheckEvicted() const {
+		// 제거된 표본의 인덱스는 이미 해제되었으므로, 구간 표본의 분기로 넘어가 엉뚱한 값을 읽지 않도록 막습니다.
+		if (m_IsEvicted) throw std::runtime_error("the sample is evicted");
+	}
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <StatSim/DataWriter.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace StatSim {
+	DataWriter::DataWriter(std::ostream& stream, char separator, std::optional<int> precision, ThreadPool* threadPool) noexcept
+		: m_Stream(stream), m_Separator(separator), m_Precision(precision), m_ThreadPool(threadPool) {
+		assert(!precision || (*precision >= 0 && *precision <= 64));
+	}
+
+	void DataWriter::Write(const Data& data) {
+		Write(data, 0, data.GetSize());
+	}
+	void DataWriter::Write(const Data& data, std::int64_t begin, std::int64_t end, int stride) {
+		assert(0 <= begin && begin <= end && end <= data.GetSize());
+		assert(stride >= 1);
+
+		const std::int64_t count = (end - begin + stride - 1) / stride;
+		const std::int64_t blockCount = (count + BlockSize - 1) / BlockSize;
+		const int groupSize = m_ThreadPool ? m_ThreadPool->GetThreadCount() : 1;
+
+		// 스레드마다 한 블록씩 동시에 만들고, 만든 블록은 순서대로 한 번에 씁니다.
+		std::vector<std::string> buffers(groupSize);
+		for (std::int64_t group = 0; group < blockCount; group += groupSize) {
+			const int groupBlockCount = static_cast<int>(std::min<std::int64_t>(groupSize, blockCount - group));
+			const auto formatBlock = [&](int i) {
+				const std::int64_t first = (group + i) * BlockSize;
+				const std::int64_t last = std::min(first + BlockSize, count);
+				Format(data, begin + first * stride, begin + last * stride, stride, buffers[i]);
+			};
+
+			if (m_ThreadPool && groupBlockCount > 1) {
+				m_ThreadPool->ParallelFor(groupBlockCount, [&](std::size_t first, std::size_t last, int) {
+					for (std::size_t i = first; i < last; ++i) {
+						formatBlock(static_cast<int>(i));
+					}
+				});
+			} else {
+				for (int i = 0; i < groupBlockCount; ++i) {
+					formatBlock(i);
+				}
+			}
+
+			for (int i = 0; i < groupBlockCount; ++i) {
+				m_Stream.write(buffers[i].data(), static_cast<std::streamsize>(buffers[i].size()));
+			}
+		}
+		m_Stream.flush();
+	}
+
+	void DataWriter::Format(const Data& data, std::int64_t begin, std::int64_t end, int stride, std::string& buffer) const {
+		// 고정 소수점 표현은 최대 309자리의 정수부를 가질 수 있습니다.
+		char text[512];
+
+		buffer.clear();
+		buffer.reserve(static_cast<std::size_t>((end - begin + stride - 1) / stride) * 16);
+		for (std::int64_t i = begin; i < end; i += stride) {
+			const auto result = m_Precision ? std::to_chars(text, text + sizeof(text) - 1, data[i], std::chars_format::fixed, *m_Precision) :
+				std::to_chars(text, text + sizeof(text) - 1, data[i]);
+			if (result.ec != std::errc()) throw std::runtime_error("failed to format the value");
+
+			*result.ptr = m_Separator;
+			buffer.append(text, result.ptr + 1);
+		}
+	}
+}
\ No newline at end of file
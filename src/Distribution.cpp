@@ -1,13 +1,30 @@
 #include <StatSim/Distribution.hpp>
 
 #include <StatSim/Math.hpp>
+#include <StatSim/Sampler.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
 #include <cmath>
 #include <cstdio>
 #include <memory>
 #include <iomanip>
 #include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#	define NOMINMAX
+#	include <Windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/socket.h>
+#	include <sys/wait.h>
+#	include <unistd.h>
+#endif
 
 namespace StatSim {
 	const Interval Interval::Real(-Interval::Infinity, Interval::Infinity);
@@ -16,7 +33,7 @@ namespace StatSim {
 		: Interval(begin, true, end, true) {}
 	Interval::Interval(double begin, bool isBeginOpen, double end, bool isEndOpen) noexcept
 		: m_Begin(begin), m_End(end), m_IsBeginOpen(isBeginOpen), m_IsEndOpen(isEndOpen) {
-		assert(begin < end);
+		assert(begin < end || (begin == end && !isBeginOpen && !isEndOpen));
 
 		if (begin == -Infinity) {
 			m_IsBeginOpen = true;
@@ -84,22 +101,33 @@ namespace StatSim {
 }
 
 namespace StatSim {
-	static std::mt19937 g_Random(std::random_device{}());
-
 	double Distribution::GetVariance() const {
 		return std::pow(GetStandardDeviation(), 2);
 	}
 	double Distribution::GetStandardDeviation() const {
 		return std::sqrt(GetVariance());
 	}
+
+	void Distribution::Generate(std::span<double> values) {
+		for (double& value : values) {
+			value = Generate();
+		}
+	}
+
+	void Distribution::SetRandomEngine(const RandomEngine& randomEngine) noexcept {
+		m_RandomEngine = randomEngine;
+	}
+	RandomEngine& Distribution::GetRandomEngine() noexcept {
+		return m_RandomEngine;
+	}
 }
 
 namespace StatSim {
-	BinomialDistribution::BinomialDistribution(int tryCount, double probability) noexcept
-		: m_Distribution(tryCount, probability) {}
+	BinomialDistribution::BinomialDistribution(int tryCount, double probability)
+		: m_TryCount(tryCount), m_Probability(probability), m_Sampler(tryCount, probability) {}
 
 	std::string BinomialDistribution::GetName() const {
-		return "׺";
+		return "이항분포";
 	}
 	std::string BinomialDistribution::GetExpression() const {
 		std::ostringstream oss;
@@ -121,23 +149,73 @@ namespace StatSim {
 	}
 
 	double BinomialDistribution::Generate() {
-		return m_Distribution(g_Random);
+		double value;
+		m_Sampler.Generate(std::span<double>(&value, 1), [this](std::span<std::uint64_t> bits) {
+			GetRandomEngine().Fill(bits);
+		});
+		return value;
+	}
+	void BinomialDistribution::Generate(std::span<double> values) {
+		m_Sampler.Generate(values, [this](std::span<std::uint64_t> bits) {
+			GetRandomEngine().Fill(bits);
+		});
 	}
 	double BinomialDistribution::GetProbability(double begin, double end) const {
-		const int beginInt = static_cast<int>(std::ceil(begin));
-		const int endInt = static_cast<int>(std::floor(end));
+		if (!(begin <= end)) return 0;
 
-		double result = 0;
-		for (int i = beginInt; i <= endInt; ++i) {
-			result += BinomialPMF(GetTryCount(), i, GetProbability());
-		}
-		return result;
+		// 정수로 바꾸기 전에 잘라 무한대나 int의 범위를 벗어난 값도 안전하게 다룹니다.
+		const double tryCount = GetTryCount();
+		const int beginInt = static_cast<int>(std::clamp(std::ceil(begin), 0.0, tryCount + 1));
+		const int endInt = static_cast<int>(std::clamp(std::floor(end), -1.0, tryCount));
+		if (beginInt > endInt) return 0;
+		else if (beginInt == endInt) return BinomialPMF(GetTryCount(), beginInt, GetProbability());
+
+		// 1에 가까운 누적 확률끼리 빼면 꼬리의 작은 확률이 0이 되므로, 평균보다 위의 구간은 생존 함수로 구합니다.
+		if (beginInt > GetMean()) return std::max(GetSurvival(beginInt) - GetSurvival(endInt + 1), 0.0);
+		else return std::max(GetCDF(endInt) - GetCDF(beginInt - 1), 0.0);
 	}
 	int BinomialDistribution::GetTryCount() const noexcept {
-		return m_Distribution.t();
+		return m_TryCount;
 	}
 	double BinomialDistribution::GetProbability() const noexcept {
-		return m_Distribution.p();
+		return m_Probability;
+	}
+
+	double BinomialDistribution::GetCDF(int occurCount) const {
+		if (occurCount < 0) return 0;
+		else if (occurCount >= GetTryCount()) return 1;
+		else if (GetTryCount() > MaxCDFTableTryCount) return BinomialCDF(GetTryCount(), occurCount, GetProbability());
+
+		CreateCDFTable();
+		return m_CDFTable[occurCount];
+	}
+	double BinomialDistribution::GetSurvival(int occurCount) const {
+		if (occurCount <= 0) return 1;
+		else if (occurCount > GetTryCount()) return 0;
+		else if (GetTryCount() > MaxCDFTableTryCount) return BinomialSurvival(GetTryCount(), occurCount, GetProbability());
+
+		CreateCDFTable();
+		return m_SurvivalTable[occurCount];
+	}
+	void BinomialDistribution::CreateCDFTable() const {
+		std::call_once(m_CDFTableFlag, [this]() {
+			m_CDFTable.resize(GetTryCount() + 1);
+			m_SurvivalTable.resize(GetTryCount() + 1);
+
+			// 보정 합으로 누적해 표 끝에서도 오차가 쌓이지 않게 합니다. 생존 함수는 위에서부터 누적합니다.
+			const auto accumulate = [this](std::vector<double>& table, int first, int step) {
+				double sum = 0, compensation = 0;
+				for (int i = first; 0 <= i && i <= GetTryCount(); i += step) {
+					const double y = BinomialPMF(GetTryCount(), i, GetProbability()) - compensation;
+					const double t = sum + y;
+					compensation = (t - sum) - y;
+					sum = t;
+					table[i] = std::min(sum, 1.0);
+				}
+			};
+			accumulate(m_CDFTable, 0, 1);
+			accumulate(m_SurvivalTable, GetTryCount(), -1);
+		});
 	}
 }
 
@@ -146,11 +224,11 @@ namespace StatSim {
 		: m_Distribution(mean, standardDeviation) {}
 
 	std::string NormalDistribution::GetName() const {
-		return "Ժ";
+		return "정규분포";
 	}
 	std::string NormalDistribution::GetExpression() const {
 		std::ostringstream oss;
-		oss << "N(" << GetMean() << ", " << GetStandardDeviation() << ")";
+		oss << "N(" << GetMean() << ", " << GetStandardDeviation() << "²)";
 		return oss.str();
 	}
 	RandomVariable NormalDistribution::GetRandomVariable() const noexcept {
@@ -168,22 +246,239 @@ namespace StatSim {
 	}
 
 	double NormalDistribution::Generate() {
-		return m_Distribution(g_Random);
+		return m_Distribution(GetRandomEngine());
+	}
+	void NormalDistribution::Generate(std::span<double> values) {
+		GenerateStandardNormal(values, [this](std::span<std::uint64_t> bits) {
+			GetRandomEngine().Fill(bits);
+		});
+
+		const double mean = GetMean(), standardDeviation = GetStandardDeviation();
+		for (double& value : values) {
+			value = mean + standardDeviation * value;
+		}
 	}
 	double NormalDistribution::GetProbability(double begin, double end) const {
 		return NormalCDF(end, GetMean(), GetStandardDeviation()) - NormalCDF(begin, GetMean(), GetStandardDeviation());
 	}
 }
 
+namespace StatSim {
+	class PDFProgram::Process final {
+	private:
+#ifdef _WIN32
+		void* m_Input = nullptr;
+		void* m_Output = nullptr;
+		void* m_Process = nullptr;
+#else
+		int m_Socket = -1;
+		pid_t m_ProcessId = -1;
+#endif
+		std::string m_Buffer;
+		std::mutex m_Mutex;
+
+	public:
+		explicit Process(const std::string& command);
+		Process(const Process&) = delete;
+		~Process();
+
+	public:
+		Process& operator=(const Process&) = delete;
+
+	public:
+		std::vector<double> Evaluate(const std::string_view& command, std::span<const double> x);
+
+	private:
+		bool Write(const std::string& data) noexcept;
+		std::size_t Read(char* buffer, std::size_t size) noexcept;
+		std::string ReadLine();
+	};
+
+#ifdef _WIN32
+	PDFProgram::Process::Process(const std::string& command) {
+		SECURITY_ATTRIBUTES attributes{ sizeof(attributes), nullptr, TRUE };
+		HANDLE childInput, childOutput;
+		if (!CreatePipe(&childInput, &m_Input, &attributes, 0)) throw std::runtime_error("failed to create the pipe");
+		if (!CreatePipe(&m_Output, &childOutput, &attributes, 0)) {
+			CloseHandle(childInput);
+			CloseHandle(m_Input);
+			throw std::runtime_error("failed to create the pipe");
+		}
+		SetHandleInformation(m_Input, HANDLE_FLAG_INHERIT, 0);
+		SetHandleInformation(m_Output, HANDLE_FLAG_INHERIT, 0);
+
+		STARTUPINFOA startupInfo{ sizeof(startupInfo) };
+		startupInfo.dwFlags = STARTF_USESTDHANDLES;
+		startupInfo.hStdInput = childInput;
+		startupInfo.hStdOutput = childOutput;
+		startupInfo.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+
+		PROCESS_INFORMATION processInfo;
+		std::string commandLine = "cmd /c " + command;
+		const BOOL isCreated = CreateProcessA(nullptr, commandLine.data(), nullptr, nullptr, TRUE, 0, nullptr, nullptr, &startupInfo, &processInfo);
+		CloseHandle(childInput);
+		CloseHandle(childOutput);
+		if (!isCreated) {
+			CloseHandle(m_Input);
+			CloseHandle(m_Output);
+			throw std::runtime_error("failed to start the program");
+		}
+
+		CloseHandle(processInfo.hThread);
+		m_Process = processInfo.hProcess;
+	}
+	PDFProgram::Process::~Process() {
+		Write("QUIT\n");
+		CloseHandle(m_Input);
+		CloseHandle(m_Output);
+		WaitForSingleObject(m_Process, INFINITE);
+		CloseHandle(m_Process);
+	}
+
+	bool PDFProgram::Process::Write(const std::string& data) noexcept {
+		for (std::size_t written = 0; written < data.size();) {
+			DWORD count;
+			if (!WriteFile(m_Input, data.data() + written, static_cast<DWORD>(data.size() - written), &count, nullptr)) return false;
+			written += count;
+		}
+		return true;
+	}
+	std::size_t PDFProgram::Process::Read(char* buffer, std::size_t size) noexcept {
+		DWORD count;
+		if (!ReadFile(m_Output, buffer, static_cast<DWORD>(size), &count, nullptr)) return 0;
+		return count;
+	}
+#else
+	PDFProgram::Process::Process(const std::string& command) {
+		// 소켓 쌍을 쓰면 프로그램이 먼저 종료되어도 SIGPIPE 없이 쓰기 실패로 알 수 있습니다.
+		// 나중에 만드는 다른 프로그램이 소켓을 물려받으면 이 프로그램이 EOF를 받지 못하므로 exec할 때 닫히게 합니다.
+		// 자식은 dup2로 복제한 표준 입출력을 쓰고, dup2는 이 플래그를 지우므로 그대로 남습니다.
+		int sockets[2];
+#ifdef SOCK_CLOEXEC
+		if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) == -1) throw std::runtime_error("failed to create the socket pair");
+#else
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == -1) throw std::runtime_error("failed to create the socket pair");
+		fcntl(sockets[0], F_SETFD, FD_CLOEXEC);
+		fcntl(sockets[1], F_SETFD, FD_CLOEXEC);
+#endif
+
+		m_ProcessId = fork();
+		if (m_ProcessId == -1) {
+			close(sockets[0]);
+			close(sockets[1]);
+			throw std::runtime_error("failed to start the program");
+		} else if (m_ProcessId == 0) {
+			close(sockets[0]);
+			dup2(sockets[1], STDIN_FILENO);
+			dup2(sockets[1], STDOUT_FILENO);
+			close(sockets[1]);
+			execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+			_exit(127);
+		}
+
+		close(sockets[1]);
+		m_Socket = sockets[0];
+	}
+	PDFProgram::Process::~Process() {
+		Write("QUIT\n");
+		close(m_Socket);
+		while (waitpid(m_ProcessId, nullptr, 0) == -1 && errno == EINTR);
+	}
+
+	bool PDFProgram::Process::Write(const std::string& data) noexcept {
+		for (std::size_t written = 0; written < data.size();) {
+			const ssize_t count = send(m_Socket, data.data() + written, data.size() - written, MSG_NOSIGNAL);
+			if (count == -1) {
+				if (errno == EINTR) continue;
+				return false;
+			}
+			written += static_cast<std::size_t>(count);
+		}
+		return true;
+	}
+	std::size_t PDFProgram::Process::Read(char* buffer, std::size_t size) noexcept {
+		ssize_t count;
+		while ((count = recv(m_Socket, buffer, size, 0)) == -1 && errno == EINTR);
+		return count > 0 ? static_cast<std::size_t>(count) : 0;
+	}
+#endif
+
+	std::vector<double> PDFProgram::Process::Evaluate(const std::string_view& command, std::span<const double> x) {
+		std::vector<double> result;
+		result.reserve(x.size());
+
+		std::string request;
+		char text[32];
+
+		const std::lock_guard lock(m_Mutex);
+		for (std::size_t first = 0; first < x.size(); first += MaxBatchSize) {
+			const std::size_t count = std::min(MaxBatchSize, x.size() - first);
+
+			request.assign(command);
+			request += ' ';
+			request += std::to_string(count);
+			for (std::size_t i = first; i < first + count; ++i) {
+				const auto textEnd = std::to_chars(text, text + sizeof(text), x[i]).ptr;
+				request += ' ';
+				request.append(text, textEnd);
+			}
+			request += '\n';
+			if (!Write(request)) throw std::runtime_error("failed to send the request to the program");
+
+			const std::string response = ReadLine();
+			const char* current = response.data();
+			const char* const end = current + response.size();
+			for (std::size_t i = 0; i < count; ++i) {
+				while (current < end && std::isspace(static_cast<unsigned char>(*current))) {
+					++current;
+				}
+
+				double value;
+				const auto parsed = std::from_chars(current, end, value);
+				if (parsed.ec != std::errc()) throw std::runtime_error("failed to read the values from the program");
+
+				result.push_back(value);
+				current = parsed.ptr;
+			}
+		}
+		return result;
+	}
+	std::string PDFProgram::Process::ReadLine() {
+		std::size_t lineEnd;
+		while ((lineEnd = m_Buffer.find('\n')) == std::string::npos) {
+			char buffer[4096];
+			const std::size_t count = Read(buffer, sizeof(buffer));
+			if (count == 0) throw std::runtime_error("failed to read the response from the program");
+
+			m_Buffer.append(buffer, count);
+		}
+
+		std::string line = m_Buffer.substr(0, lineEnd);
+		m_Buffer.erase(0, lineEnd + 1);
+		return line;
+	}
+}
+
 namespace StatSim {
 	PDFProgram PDFProgram::Load(const std::string_view& programPath) {
 		PDFProgram result;
 		result.m_ProgramPath = programPath;
 
-		const int implementationLevel = static_cast<int>(result.GetValue("ILVL", 0));
+		std::istringstream handshake(result.Run("ILVL", 0));
+		int implementationLevel;
+		if (!(handshake >> implementationLevel)) throw std::runtime_error("failed to read the implementation level");
+
 		result.m_HasCDF = (implementationLevel >= 1);
 		result.m_HasICDF = (implementationLevel >= 2);
 
+		// 구현 수준 뒤에 붙는 단어는 선택 기능입니다. 모르는 단어는 무시합니다.
+		std::string feature;
+		while (handshake >> feature) {
+			if (feature == "SERVE" && !result.m_Process) {
+				result.m_Process = std::make_shared<Process>(result.m_ProgramPath + " SERVE");
+			}
+		}
+
 		// TODO
 
 		return result;
@@ -194,16 +489,46 @@ namespace StatSim {
 	}
 	double PDFProgram::CDF(double x) const {
 		if (m_HasCDF) return GetValue("CDF", x);
-
-		// TODO
+		else throw std::runtime_error("failed to evaluate CDF; the program does not implement it");
 	}
 	double PDFProgram::ICDF(double x) const {
 		if (m_HasICDF) return GetValue("ICDF", x);
+		else throw std::runtime_error("failed to evaluate ICDF; the program does not implement it");
+	}
+	std::vector<double> PDFProgram::PDF(std::span<const double> x) const {
+		return GetValues("PDF", x);
+	}
+	std::vector<double> PDFProgram::CDF(std::span<const double> x) const {
+		if (m_HasCDF) return GetValues("CDF", x);
+		else throw std::runtime_error("failed to evaluate CDF; the program does not implement it");
+	}
+	std::vector<double> PDFProgram::ICDF(std::span<const double> x) const {
+		if (m_HasICDF) return GetValues("ICDF", x);
+		else throw std::runtime_error("failed to evaluate ICDF; the program does not implement it");
+	}
 
-		// TODO
+	bool PDFProgram::HasCDF() const noexcept {
+		return m_HasCDF;
+	}
+	bool PDFProgram::HasICDF() const noexcept {
+		return m_HasICDF;
+	}
+	bool PDFProgram::IsPersistent() const noexcept {
+		return m_Process != nullptr;
 	}
 
 	double PDFProgram::GetValue(const std::string_view& command, double x) const {
+		if (m_Process) return m_Process->Evaluate(command, std::span<const double>(&x, 1)).front();
+		else return std::stod(Run(command, x));
+	}
+	std::vector<double> PDFProgram::GetValues(const std::string_view& command, std::span<const double> x) const {
+		if (m_Process) return m_Process->Evaluate(command, x);
+
+		std::vector<double> result(x.size());
+		std::transform(x.begin(), x.end(), result.begin(), [&](double x) { return std::stod(Run(command, x)); });
+		return result;
+	}
+	std::string PDFProgram::Run(const std::string_view& command, double x) const {
 #ifndef _WIN32
 #		define _popen popen
 #		define _pclose pclose
@@ -222,7 +547,302 @@ namespace StatSim {
 		while (fgets(buffer, sizeof(buffer), program)) {
 			output += buffer;
 		}
-		return std::stod(output);
+		return output;
+	}
+}
+
+namespace StatSim {
+	ProgramDistribution::ProgramDistribution(PDFProgram program, const Interval& support)
+		: m_Program(std::move(program)), m_Uniform(0, 1) {
+		m_Table = CreateTable(m_Program, FindSupport(m_Program, support));
+	}
+	ProgramDistribution::ProgramDistribution(PDFProgram program, std::shared_ptr<const Table> table) noexcept
+		: m_Program(std::move(program)), m_Table(std::move(table)), m_Uniform(0, 1) {}
+
+	std::string ProgramDistribution::GetName() const {
+		return "사용자 정의 분포";
+	}
+	std::string ProgramDistribution::GetExpression() const {
+		std::ostringstream oss;
+		oss << "PDF 프로그램(구간 " << m_Table->Nodes.front() << " ~ " << m_Table->Nodes.back() << ", " << GetCellCount() << "개 구간)";
+		return oss.str();
+	}
+	RandomVariable ProgramDistribution::GetRandomVariable() const noexcept {
+		return RandomVariable::Continuous({ m_Table->Nodes.front(), m_Table->Nodes.back() });
+	}
+	Distribution* ProgramDistribution::Copy() const {
+		return new ProgramDistribution(m_Program, m_Table);
+	}
+
+	double ProgramDistribution::GetMean() const {
+		return m_Table->Mean;
+	}
+	double ProgramDistribution::GetVariance() const {
+		return m_Table->Variance;
+	}
+
+	double ProgramDistribution::Generate() {
+		return ICDF(m_Uniform(GetRandomEngine()));
+	}
+	void ProgramDistribution::Generate(std::span<double> values) {
+		for (double& value : values) {
+			value = ICDF(m_Uniform(GetRandomEngine()));
+		}
+	}
+	double ProgramDistribution::GetProbability(double begin, double end) const {
+		return std::max(CDF(end) - CDF(begin), 0.0);
+	}
+	double ProgramDistribution::CDF(double x) const noexcept {
+		const Table& table = *m_Table;
+		if (!(x > table.Nodes.front())) return 0;
+		else if (x >= table.Nodes.back()) return 1;
+
+		const std::size_t i = std::upper_bound(table.Nodes.begin(), table.Nodes.end(), x) - table.Nodes.begin() - 1;
+		const double width = table.Nodes[i + 1] - table.Nodes[i];
+		const double t = x - table.Nodes[i];
+		const double left = table.LeftDensities[i], right = table.RightDensities[i];
+		return std::min(table.CDF[i] + t * (left + (right - left) * t / (2 * width)), table.CDF[i + 1]);
+	}
+	double ProgramDistribution::ICDF(double p) const noexcept {
+		const Table& table = *m_Table;
+		const std::size_t cellCount = table.LeftDensities.size();
+		if (!(p > 0)) return table.Nodes.front();
+		else if (p >= 1) return table.Nodes.back();
+
+		// 안내 표로 시작 구간을 찾으면 평균적으로 한두 번만 더 이동하면 됩니다.
+		std::size_t i = table.Guide[static_cast<std::size_t>(p * table.Guide.size())];
+		while (i + 1 < cellCount && table.CDF[i + 1] < p) {
+			++i;
+		}
+
+		const double width = table.Nodes[i + 1] - table.Nodes[i];
+		const double r = p - table.CDF[i];
+		if (r <= 0) return table.Nodes[i];
+
+		// a*t^2 + b*t = r의 근을 상쇄 오차가 없는 꼴로 구합니다.
+		const double a = (table.RightDensities[i] - table.LeftDensities[i]) / (2 * width), b = table.LeftDensities[i];
+		const double denominator = b + std::sqrt(std::max(b * b + 4 * a * r, 0.0));
+		const double t = denominator > 0 ? 2 * r / denominator : width;
+		return table.Nodes[i] + std::clamp(t, 0.0, width);
+	}
+	const PDFProgram& ProgramDistribution::GetProgram() const noexcept {
+		return m_Program;
+	}
+	int ProgramDistribution::GetCellCount() const noexcept {
+		return static_cast<int>(m_Table->LeftDensities.size());
+	}
+
+	Interval ProgramDistribution::FindSupport(const PDFProgram& program, const Interval& support) {
+		const bool isBeginFinite = std::isfinite(support.GetBegin()), isEndFinite = std::isfinite(support.GetEnd());
+		if (isBeginFinite && isEndFinite) return support;
+
+		// 기준점에서 2의 거듭제곱만큼 떨어진 점들을 한 번에 계산해, 확률밀도가 최댓값에 비해 무시할 만해지는 곳까지를 구간으로 잡습니다.
+		static constexpr int MinExponent = -4, MaxExponent = 64;
+		static constexpr double TailThreshold = 1e-16;
+
+		const double center = isBeginFinite ? support.GetBegin() : isEndFinite ? support.GetEnd() : 0;
+		std::vector<double> x;
+		x.push_back(center);
+		for (int exponent = MinExponent; exponent <= MaxExponent; ++exponent) {
+			if (!isBeginFinite) {
+				x.push_back(center - std::ldexp(1.0, exponent));
+			}
+			if (!isEndFinite) {
+				x.push_back(center + std::ldexp(1.0, exponent));
+			}
+		}
+
+		std::vector<double> density = program.PDF(x);
+		for (double& value : density) {
+			if (!std::isfinite(value) || value < 0) {
+				value = 0;
+			}
+		}
+
+		const double peak = *std::max_element(density.begin(), density.end());
+		if (peak <= 0) throw std::runtime_error("failed to find the support of the PDF");
+
+		double begin = support.GetBegin(), end = support.GetEnd();
+		if (!isBeginFinite) {
+			begin = center - std::ldexp(1.0, MinExponent);
+		}
+		if (!isEndFinite) {
+			end = center + std::ldexp(1.0, MinExponent);
+		}
+		for (std::size_t i = 1; i < x.size(); ++i) {
+			if (density[i] < peak * TailThreshold) continue;
+
+			const double distance = std::abs(x[i] - center) * 2;
+			if (x[i] < center) {
+				begin = std::min(begin, center - distance);
+			} else {
+				end = std::max(end, center + distance);
+			}
+		}
+		return { begin, end };
+	}
+	std::shared_ptr<const ProgramDistribution::Table> ProgramDistribution::CreateTable(const PDFProgram& program, const Interval& support) {
+		struct Cell final {
+			double Begin, End;
+			double BeginDensity, MiddleDensity, EndDensity;
+			int Depth;
+		};
+
+		const auto evaluate = [&program](const std::vector<double>& x) {
+			std::vector<double> density = program.PDF(x);
+			for (double& value : density) {
+				if (!std::isfinite(value) || value < 0) {
+					value = 0;
+				}
+			}
+			return density;
+		};
+		const auto simpson = [](double begin, double end, double beginDensity, double middleDensity, double endDensity) {
+			return (end - begin) / 6 * (beginDensity + 4 * middleDensity + endDensity);
+		};
+
+		const double begin = support.GetBegin(), length = support.GetLength();
+
+		std::vector<double> x(2 * InitialCellCount + 1);
+		for (int i = 0; i <= 2 * InitialCellCount; ++i) {
+			x[i] = begin + length * i / (2 * InitialCellCount);
+		}
+		x.back() = support.GetEnd();
+
+		std::vector<double> density = evaluate(x);
+		std::vector<Cell> pending;
+		double estimate = 0;
+		for (int i = 0; i < InitialCellCount; ++i) {
+			pending.push_back({ x[2 * i], x[2 * i + 2], density[2 * i], density[2 * i + 1], density[2 * i + 2], 0 });
+			estimate += simpson(x[2 * i], x[2 * i + 2], density[2 * i], density[2 * i + 1], density[2 * i + 2]);
+		}
+		if (!(estimate > 0)) throw std::runtime_error("failed to integrate the PDF");
+
+		// 적분 오차가 구간 길이에 비례한 허용치를 넘는 구간만 반으로 나눕니다. 한 단계의 모든 점은 한 번에 계산합니다.
+		struct Leaf final {
+			double Begin, End;
+			double BeginDensity, EndDensity;
+			double Mass;
+		};
+		std::vector<Leaf> leaves;
+		while (!pending.empty()) {
+			x.clear();
+			for (const Cell& cell : pending) {
+				const double middle = (cell.Begin + cell.End) / 2;
+				x.push_back((cell.Begin + middle) / 2);
+				x.push_back((middle + cell.End) / 2);
+			}
+			density = evaluate(x);
+
+			const bool isFull = leaves.size() + 4 * pending.size() > static_cast<std::size_t>(MaxCellCount);
+			std::vector<Cell> next;
+			for (std::size_t i = 0; i < pending.size(); ++i) {
+				const Cell& cell = pending[i];
+				const double middle = (cell.Begin + cell.End) / 2;
+				const double leftDensity = density[2 * i], rightDensity = density[2 * i + 1];
+
+				const double whole = simpson(cell.Begin, cell.End, cell.BeginDensity, cell.MiddleDensity, cell.EndDensity);
+				const double left = simpson(cell.Begin, middle, cell.BeginDensity, leftDensity, cell.MiddleDensity);
+				const double right = simpson(middle, cell.End, cell.MiddleDensity, rightDensity, cell.EndDensity);
+				const double tolerance = Tolerance * estimate * (cell.End - cell.Begin) / length;
+
+				if (isFull || cell.Depth >= MaxRefinementDepth || std::abs(left + right - whole) <= 15 * tolerance) {
+					leaves.push_back({ cell.Begin, middle, cell.BeginDensity, cell.MiddleDensity, left });
+					leaves.push_back({ middle, cell.End, cell.MiddleDensity, cell.EndDensity, right });
+				} else {
+					next.push_back({ cell.Begin, middle, cell.BeginDensity, leftDensity, cell.MiddleDensity, cell.Depth + 1 });
+					next.push_back({ middle, cell.End, cell.MiddleDensity, rightDensity, cell.EndDensity, cell.Depth + 1 });
+				}
+			}
+			pending = std::move(next);
+		}
+		std::sort(leaves.begin(), leaves.end(), [](const Leaf& a, const Leaf& b) {
+			return a.Begin < b.Begin;
+		});
+
+		const auto table = std::make_shared<Table>();
+		const std::size_t cellCount = leaves.size();
+		table->Nodes.resize(cellCount + 1);
+		for (std::size_t i = 0; i < cellCount; ++i) {
+			table->Nodes[i] = leaves[i].Begin;
+		}
+		table->Nodes.back() = leaves.back().End;
+
+		// 프로그램이 CDF를 구현하면 구간의 확률을 적분 대신 CDF의 차로 구합니다.
+		if (program.HasCDF()) {
+			const std::vector<double> cdf = program.CDF(table->Nodes);
+			for (std::size_t i = 0; i < cellCount; ++i) {
+				leaves[i].Mass = std::max(cdf[i + 1] - cdf[i], 0.0);
+			}
+		}
+
+		double total = 0;
+		for (const Leaf& leaf : leaves) {
+			total += std::max(leaf.Mass, 0.0);
+		}
+		if (!(total > 0) || !std::isfinite(total)) throw std::runtime_error("failed to integrate the PDF");
+
+		table->CDF.resize(cellCount + 1);
+		table->LeftDensities.resize(cellCount);
+		table->RightDensities.resize(cellCount);
+
+		double sum = 0, compensation = 0;
+		for (std::size_t i = 0; i < cellCount; ++i) {
+			const Leaf& leaf = leaves[i];
+			const double mass = std::max(leaf.Mass, 0.0) / total;
+			const double width = leaf.End - leaf.Begin;
+			const double area = (leaf.BeginDensity + leaf.EndDensity) / 2 * width;
+
+			// 구간의 확률과 넓이가 같아지도록 양 끝 확률밀도의 비율을 유지한 채 맞춥니다.
+			if (area > 0) {
+				table->LeftDensities[i] = leaf.BeginDensity * mass / area;
+				table->RightDensities[i] = leaf.EndDensity * mass / area;
+			} else {
+				table->LeftDensities[i] = table->RightDensities[i] = mass / width;
+			}
+
+			table->CDF[i] = std::min(sum, 1.0);
+
+			const double y = mass - compensation;
+			const double t = sum + y;
+			compensation = (t - sum) - y;
+			sum = t;
+		}
+		table->CDF.back() = 1;
+
+		table->Guide.resize(cellCount);
+		for (std::size_t i = 0, cell = 0; i < cellCount; ++i) {
+			const double p = static_cast<double>(i) / cellCount;
+			while (cell + 1 < cellCount && table->CDF[cell + 1] <= p) {
+				++cell;
+			}
+			table->Guide[i] = static_cast<int>(cell);
+		}
+
+		// 각 구간에서 x - 평균의 모멘트를 닫힌 꼴로 적분합니다.
+		const auto moments = [&](std::size_t i, double origin, double& first, double& second) {
+			const double width = table->Nodes[i + 1] - table->Nodes[i];
+			const double left = table->LeftDensities[i], slope = (table->RightDensities[i] - left) / width;
+			const double c = table->Nodes[i] - origin;
+			const double mass = table->CDF[i + 1] - table->CDF[i];
+			const double t1 = left * width * width / 2 + slope * width * width * width / 3;
+			const double t2 = left * width * width * width / 3 + slope * width * width * width * width / 4;
+			first = c * mass + t1;
+			second = c * c * mass + 2 * c * t1 + t2;
+		};
+
+		double mean = 0, variance = 0, first, second;
+		for (std::size_t i = 0; i < cellCount; ++i) {
+			moments(i, 0, first, second);
+			mean += first;
+		}
+		for (std::size_t i = 0; i < cellCount; ++i) {
+			moments(i, mean, first, second);
+			variance += second;
+		}
+		table->Mean = mean;
+		table->Variance = variance;
+		return table;
 	}
 }
 
@@ -274,4 +894,24 @@ namespace StatSim {
 			return nullptr;
 		}
 	}
+}
+
+namespace StatSim {
+	ProgramDistributionGenerator::ProgramDistributionGenerator(std::string programPath) noexcept
+		: m_ProgramPath(std::move(programPath)) {}
+
+	void ProgramDistributionGenerator::SetParameter(const std::string& name, double value) {
+		if (name == "SupportBegin") {
+			m_SupportBegin = value;
+		} else if (name == "SupportEnd") {
+			m_SupportEnd = value;
+		} else if (name != "Mean" && name != "Variance") {
+			// 분포는 프로그램이 정하므로 불러온 모집단의 평균과 분산은 쓰지 않습니다.
+			assert(false);
+		}
+	}
+	Distribution* ProgramDistributionGenerator::Generate() const {
+		const Interval support(m_SupportBegin.value_or(-Interval::Infinity), m_SupportEnd.value_or(Interval::Infinity));
+		return new ProgramDistribution(PDFProgram::Load(m_ProgramPath), support);
+	}
 }
\ No newline at end of file
@@ -1,41 +1,89 @@
 #include <StatSim/Simulator.hpp>
 
 #include <StatSim/Math.hpp>
-
+#include <StatSim/Metrics.hpp>
+#include <StatSim/Scenario.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
 #include <ios>
 #include <iostream>
+#include <limits>
+#include <new>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 template<typename T>
 T ReadInput(const char* name);
 template<>
 std::string ReadInput<std::string>(const char* name);
 int ReadAction(const char* name, int max, const std::string_view& actions);
+std::int64_t ReadPopulationSize(std::int64_t max);
+void PrintSampleMeans(StatSim::Population* sampleMeans);
+void SavePopulation(StatSim::Simulator& simulator, StatSim::Population* population);
+void PrintSelectedData(StatSim::Simulator& simulator);
+void PrintMetrics(StatSim::Simulator& simulator);
+void PrintMemoryUsage(StatSim::Simulator& simulator);
+int RunScenarios(int argc, char* argv[]);
+
+int main(int argc, char* argv[]) {
+	// StatSim --metrics <경로>: 대화형 세션을 마칠 때 성능 지표를 파일로 씁니다.
+	// StatSim --memory-budget <MB>: 모집단의 메모리 예산을 정합니다. 넘으면 오래 쓰지 않은 표본의 인덱스부터 버립니다.
+	// StatSim <시나리오...>: 시나리오를 차례로 실행합니다. 시나리오의 성능 지표는 [Output] Metrics로 씁니다.
+	if (argc > 1 && !std::string_view(argv[1]).starts_with("--")) return RunScenarios(argc, argv);
 
-int main() {
 	StatSim::Simulator simulator;
+	for (int i = 1; i < argc; i += 2) {
+		const std::string_view option = argv[i];
+		const std::string_view value = i + 1 < argc ? argv[i + 1] : "";
+		double memoryBudget = 0;
+		if (option == "--metrics" && !value.empty()) {
+			simulator.SetMetricsPath(std::string(value));
+		} else if (option == "--memory-budget" && std::from_chars(value.data(), value.data() + value.size(), memoryBudget).ptr == value.data() + value.size() &&
+			memoryBudget > 0) {
+			simulator.SetMemoryBudget(static_cast<std::size_t>(memoryBudget * 1024 * 1024));
+		} else {
+			std::cerr << "올바르지 않은 인자입니다: " << option << '\n';
+			return 1;
+		}
+	}
 	std::cout << std::fixed;
 
-	// 1.  
-	// 1-1.   
-	const int populationGenerationMethod = ReadAction("  ", 2, "1. Ȯ  ϱ\n2. Ͽ ҷ");
-	std::string populationPath;
-	if (populationGenerationMethod == 2) {
+	// 0. 난수 시드
+	if (ReadAction("난수 시드", 2, "1. 무작위로 정하기\n2. 직접 입력하기") == 2) {
+		StatSim::SetGlobalSeed(ReadInput<std::uint64_t>("시드"));
+	}
+
+	// 1. 모집단 생성
+	// 1-1. 모집단 생성 방식
+	const int populationGenerationMethod = ReadAction("모집단 생성 방식", 5, "1. 확률분포에 따라 생성하기\n2. 파일에서 불러오기\n3. 바이너리 파일에서 불러오기\n"
+		"4. 확률분포에 따라 바이너리 파일로 생성하기(외부 정렬)\n5. 파일을 바이너리 파일로 변환해 불러오기(외부 정렬)");
+	const bool isPopulationGenerated = populationGenerationMethod == 1 || populationGenerationMethod == 4;
+	std::string populationPath, binaryPopulationPath;
+	if (populationGenerationMethod != 1) {
 		std::cin.ignore();
-		populationPath = ReadInput<std::string>(" ");
+		populationPath = ReadInput<std::string>(populationGenerationMethod == 4 ? "바이너리 파일 경로" : "파일 경로");
+		if (populationGenerationMethod == 5) {
+			binaryPopulationPath = ReadInput<std::string>("바이너리 파일 경로");
+		}
 	}
 
-	// 1-2.  Ȯ
+	// 1-2. 모집단 확률분포
 	StatSim::DistributionGenerator* distributionGenerator = nullptr;
-	switch (ReadAction("Ȯ ", 2, "1. ̻Ȯ\n2. Ȯ")) {
+	switch (ReadAction("확률변수 유형", 2, "1. 이산확률변수\n2. 연속확률변수")) {
 	case 1:
-		switch (ReadAction("Ȯ", 1, "1. ׺")) {
+		switch (ReadAction("확률분포", 1, "1. 이항분포")) {
 		case 1: {
 			distributionGenerator = new StatSim::BinomialDistributionGenerator();
-			if (populationGenerationMethod == 1) {
-				distributionGenerator->SetParameter("TryCount", ReadInput<int>("õ Ƚ"));
-				distributionGenerator->SetParameter("Probability", ReadInput<double>(" Ȯ"));
+			if (isPopulationGenerated) {
+				distributionGenerator->SetParameter("TryCount", ReadInput<int>("시도 횟수"));
+				distributionGenerator->SetParameter("Probability", ReadInput<double>("사건의 확률"));
 			}
 			break;
 		}
@@ -43,12 +91,22 @@ int main() {
 		break;
 
 	case 2:
-		switch (ReadAction("Ȯ", 1, "1. Ժ")) {
+		switch (ReadAction("확률분포", 2, "1. 정규분포\n2. PDF 프로그램")) {
 		case 1: {
 			distributionGenerator = new StatSim::NormalDistributionGenerator();
-			if (populationGenerationMethod == 1) {
-				distributionGenerator->SetParameter("Mean", ReadInput<int>(""));
-				distributionGenerator->SetParameter("StandardDeviation", ReadInput<double>("ǥ"));
+			if (isPopulationGenerated) {
+				distributionGenerator->SetParameter("Mean", ReadInput<int>("모평균"));
+				distributionGenerator->SetParameter("StandardDeviation", ReadInput<double>("모표준편차"));
+			}
+			break;
+		}
+
+		case 2: {
+			std::cin.ignore();
+			distributionGenerator = new StatSim::ProgramDistributionGenerator(ReadInput<std::string>("PDF 프로그램 경로"));
+			if (ReadAction("확률변수의 범위", 2, "1. 자동으로 찾기\n2. 직접 입력하기") == 2) {
+				distributionGenerator->SetParameter("SupportBegin", ReadInput<double>("하한"));
+				distributionGenerator->SetParameter("SupportEnd", ReadInput<double>("상한"));
 			}
 			break;
 		}
@@ -56,27 +114,34 @@ int main() {
 		break;
 	}
 
-	// 1-3.  
+	// 1-3. 모집단 생성
 	if (populationGenerationMethod == 1) {
-		const int populationSize = ReadInput<int>(" ũ");
+		const int populationSize = static_cast<int>(ReadPopulationSize(std::numeric_limits<int>::max()));
 		simulator.GeneratePopulation(populationSize, distributionGenerator->Generate());
-	} else {
+	} else if (populationGenerationMethod == 2) {
 		simulator.LoadPopulation(populationPath, distributionGenerator);
+	} else if (populationGenerationMethod == 3) {
+		simulator.LoadBinaryPopulation(populationPath, distributionGenerator);
+	} else if (populationGenerationMethod == 4) {
+		const std::int64_t populationSize = ReadPopulationSize(std::numeric_limits<std::int64_t>::max());
+		simulator.GenerateBinaryPopulation(populationPath, populationSize, distributionGenerator);
+	} else {
+		simulator.ConvertPopulation(populationPath, binaryPopulationPath, distributionGenerator);
 	}
 	delete distributionGenerator;
 
-	// 2. 
+	// 2. 동작
 	while (true) {
 		StatSim::Data* const data = simulator.GetSelectedData();
 		StatSim::Distribution* const distribution = data->GetDistribution();
 
-		std::cout << "----------\n : " << data->GetName() << '\n';
+		std::cout << "----------\n동작 대상: " << data->GetName() << '\n';
 		if (simulator.IsPopulationSelected()) {
-			switch (ReadAction("", 10, "1. \n2. Ȯ\n3. \n4. Ȯ \n5. ǥ \n"
-				"6. ǥ \n7. ǥ \n8. ǥ \n9. ǥ  \n10.    Ȯ ")) {
+			switch (ReadAction("동작", 14, "1. 출력\n2. 확률분포\n3. 전수조사\n4. 확률 계산\n5. 표본 목록\n"
+				"6. 표본 추출\n7. 표본 선택\n8. 표본평균의 분포\n9. 표본평균의 분포 저장\n10. 모평균 추정 적중 확률 계산\n"
+				"11. 표본평균의 분포 시뮬레이션(표본 저장 안 함)\n12. 메모리 사용량\n13. 성능 지표\n14. 종료")) {
 			case 1:
-				simulator.PrintSelectedData();
-				std::cout << '\n';
+				PrintSelectedData(simulator);
 				break;
 
 			case 2:
@@ -85,33 +150,34 @@ int main() {
 
 			case 3: {
 				const double mathMean = distribution->GetMean(), statMean = data->GetMean(), errMean = statMean - mathMean;
-				std::cout << " : " << mathMean << "\n : " << statMean << "( " << errMean << ")\n";
+				std::cout << "수학적 모평균: " << mathMean << "\n통계적 모평균: " << statMean << "(오차 " << errMean << ")\n";
 
 				const double mathVariance = distribution->GetVariance(), statVariance = data->GetVariance(), errVariance = statVariance - mathVariance;
-				std::cout << " л: " << mathVariance << "\n л: " << statVariance << "( " << errVariance << ")\n";
+				std::cout << "수학적 모분산: " << mathVariance << "\n통계적 모분산: " << statVariance << "(오차 " << errVariance << ")\n";
 
 				const double mathStandardDeviation = distribution->GetStandardDeviation(), statStandardDeviation = data->GetStandardDeviation(),
 					errStandardDeviation = statStandardDeviation - mathStandardDeviation;
-				std::cout << " ǥ: " << mathStandardDeviation << "\n ǥ: " << statStandardDeviation << "( " << errStandardDeviation << ")\n";
+				std::cout << "수학적 모표준편차: " << mathStandardDeviation << "\n통계적 모표준편차: " << statStandardDeviation << "(오차 " << errStandardDeviation << ")\n";
 				break;
 			}
 
 			case 4: {
-				std::cout << "P(a<=X<=b)  մϴ.\n";
-				const double a = ReadInput<double>("a ");
-				const double b = ReadInput<double>("b ");
+				std::cout << "P(a<=X<=b)의 값을 계산합니다.\n";
+				const double a = ReadInput<double>("a의 값");
+				const double b = ReadInput<double>("b의 값");
 
+				const auto timer = simulator.GetMetrics().Measure("GetProbability");
 				const double mathProbability = distribution->GetProbability(a, b), statProbability = data->GetProbability(a, b),
 					errProbability = statProbability - mathProbability;
-				std::cout << " Ȯ: " << mathProbability << "\n Ȯ: " << statProbability << "( " << errProbability << ")\n";
+				std::cout << "수학적 확률: " << mathProbability << "\n통계적 확률: " << statProbability << "(오차 " << errProbability << ")\n";
 				break;
 			}
 
 			case 5: {
 				StatSim::Population* const population = static_cast<StatSim::Population*>(data);
-				const auto samples = population->GetSamples();
-				for (const auto& [size, samples] : samples) {
-					std::cout << "n=" << size << " ǥ\n";
+				for (const int size : population->GetSampleSizes()) {
+					const auto samples = population->GetSamples(size);
+					std::cout << "n=" << size << "인 표본\n";
 
 					StatSim::Sample* firstSample = nullptr;
 					for (int i = 0; i < static_cast<int>(samples.size()); ++i) {
@@ -135,35 +201,29 @@ int main() {
 			}
 
 			case 6: {
-				const int size = ReadInput<int>("ǥ ũ");
+				const int size = ReadInput<int>("표본의 크기");
 				if (size < 1 || size > data->GetSize()) {
-					std::cout << "ùٸ  ũԴϴ.\n";
+					std::cout << "올바르지 않은 크기입니다.\n";
 					break;
 				}
-				const int enableReplacement = ReadAction(" ", 2, "1. 񺹿 \n2.  ") - 1;
-				const int loop = ReadInput<int>(" Ƚ");
+				const int enableReplacement = ReadAction("추출 방법", 2, "1. 비복원 추출\n2. 복원 추출") - 1;
+				const int loop = ReadInput<int>("추출 횟수");
 				if (loop < 1) {
-					std::cout << "ùٸ  ȽԴϴ.\n";
+					std::cout << "올바르지 않은 횟수입니다.\n";
 					break;
 				}
 
 				StatSim::Population* const population = static_cast<StatSim::Population*>(data);
 
-				StatSim::Sample* firstSample = nullptr;
-				StatSim::Sample* lastSample = nullptr;
-				for (int i = 0; i < loop; ++i) {
-					StatSim::Sample* const sample = population->Sample(size, enableReplacement);
-					if (i == 0) {
-						lastSample = firstSample = sample;
-					} else if (i + 1 == loop) {
-						lastSample = sample;
-					}
-				}
+				const auto timer = simulator.GetMetrics().Measure("SampleBatch", static_cast<std::uint64_t>(size) * loop * population->GetIndexWidth());
+				const auto samples = population->SampleBatch(size, loop, enableReplacement, simulator.GetThreadPool());
+				StatSim::Sample* const firstSample = samples.front();
+				StatSim::Sample* const lastSample = samples.back();
 
 				if (firstSample == lastSample) {
-					std::cout << firstSample->GetName() << " Ǿϴ.\n";
+					std::cout << firstSample->GetName() << "이 생성되었습니다.\n";
 				} else {
-					std::cout << firstSample->GetName() << " ~ " << lastSample->GetName() << " Ǿϴ.\n";
+					std::cout << firstSample->GetName() << " ~ " << lastSample->GetName() << "이 생성되었습니다.\n";
 				}
 				break;
 			}
@@ -171,9 +231,9 @@ int main() {
 			case 7: {
 				StatSim::Population* const population = static_cast<StatSim::Population*>(data);
 
-				const int index = ReadInput<int>("ǥ ȣ");
-				if (index < 0 || index > population->GetSampleCount()) {
-					std::cout << "ùٸ  ȣԴϴ.\n";
+				const int index = ReadInput<int>("표본의 번호");
+				if (index < 0 || index >= population->GetSampleCount()) {
+					std::cout << "올바르지 않은 번호입니다.\n";
 					break;
 				}
 
@@ -182,95 +242,132 @@ int main() {
 			}
 
 			case 8: {
-				const int size = ReadInput<int>("ǥ ũ");
+				const int size = ReadInput<int>("표본의 크기");
 				if (size < 1 || size > data->GetSize()) {
-					std::cout << "ùٸ  ũԴϴ.\n";
+					std::cout << "올바르지 않은 크기입니다.\n";
 					break;
 				}
 
 				StatSim::Population* const population = static_cast<StatSim::Population*>(data);
-				const auto samples = population->GetSamples();
-				if (samples.find(size) == samples.end()) {
-					std::cout << "ش ũ ǥ  ʽϴ.\n";
+				if (population->GetSamples(size).empty()) {
+					std::cout << "해당 크기의 표본이 존재하지 않습니다.\n";
 					break;
 				}
 
-				StatSim::Population* const sampleMeans = population->CreateSampleMeanPopulation(size);
-				StatSim::Distribution* const sampleMeansDistribution = sampleMeans->GetDistribution();
-
-				const double mathMean = sampleMeansDistribution->GetMean(), statMean = sampleMeans->GetMean(), errMean = statMean - mathMean;
-				std::cout << "ǥ  : " << mathMean << "\nǥ  : " << statMean << "( " << errMean << ")\n";
-
-				const double mathVariance = sampleMeansDistribution->GetVariance(), statVariance = sampleMeans->GetVariance(),
-					errVariance = statVariance - mathVariance;
-				std::cout << "ǥ  л: " << mathVariance << "\nǥ  л: " << statVariance << "( " << errVariance << ")\n";
-
-				const double mathStandardDeviation = sampleMeansDistribution->GetStandardDeviation(), statStandardDeviation = sampleMeans->GetStandardDeviation(),
-					errStandardDeviation = statStandardDeviation - mathStandardDeviation;
-				std::cout << "ǥ  ǥ: " << mathStandardDeviation << "\nǥ  ǥ: " << statStandardDeviation << "( " << errStandardDeviation << ")\n";
+				StatSim::Population* sampleMeans;
+				{
+					const auto timer = simulator.GetMetrics().Measure("CreateSampleMeanPopulation");
+					sampleMeans = population->CreateSampleMeanPopulation(size);
+				}
+				PrintSampleMeans(sampleMeans);
+				delete sampleMeans;
 				break;
 			}
 
 			case 9: {
-				const int size = ReadInput<int>("ǥ ũ");
+				const int size = ReadInput<int>("표본의 크기");
 				if (size < 1 || size > data->GetSize()) {
-					std::cout << "ùٸ  ũԴϴ.\n";
+					std::cout << "올바르지 않은 크기입니다.\n";
 					break;
 				}
 
 				StatSim::Population* const population = static_cast<StatSim::Population*>(data);
-				const auto samples = population->GetSamples();
-				if (samples.find(size) == samples.end()) {
-					std::cout << "ش ũ ǥ  ʽϴ.\n";
+				if (population->GetSamples(size).empty()) {
+					std::cout << "해당 크기의 표본이 존재하지 않습니다.\n";
 					break;
 				}
 
-				StatSim::Population* const sampleMeans = population->CreateSampleMeanPopulation(size);
-
-				std::cin.ignore();
-				const std::string path = ReadInput<std::string>(" ");
-				sampleMeans->Save(path);
+				StatSim::Population* sampleMeans;
+				{
+					const auto timer = simulator.GetMetrics().Measure("CreateSampleMeanPopulation");
+					sampleMeans = population->CreateSampleMeanPopulation(size);
+				}
+				SavePopulation(simulator, sampleMeans);
+				delete sampleMeans;
 				break;
 			}
 
 			case 10: {
-				const double k = ReadInput<double>("ŷ ");
+				const int kCount = ReadInput<int>("신뢰 상수의 개수");
+				if (kCount < 1) {
+					std::cout << "올바르지 않은 개수입니다.\n";
+					break;
+				}
+				std::vector<double> k(kCount);
+				for (double& value : k) {
+					value = ReadInput<double>("신뢰 상수");
+					if (!(value > 0)) break;
+				}
+				if (!std::ranges::all_of(k, [](double value) { return value > 0; })) {
+					std::cout << "올바르지 않은 신뢰 상수입니다.\n";
+					break;
+				}
 
 				StatSim::Population* const population = static_cast<StatSim::Population*>(data);
-				const auto samples = population->GetSamples();
-				if (samples.size() == 0) {
-					std::cout << "ǥ ϴ.\n";
+				if (population->GetSampleCount() == 0) {
+					std::cout << "표본이 없습니다.\n";
 					break;
 				}
 
-				const double mean = population->GetMean();
-
-				int count = 0;
-				int numberOfSamples = 0;
-				double reliability = 0;
-				for (const auto& [size, samples] : samples) {
-					for (const auto& sample : samples) {
-						const auto& [confidenceLevel, reliabilityTemp] = sample->GetConfidenceLevel(k);
-						if (reliability == 0) {
-							reliability = reliabilityTemp;
-						}
-						if (confidenceLevel.IsElement(mean)) {
-							++count;
-						}
-						++numberOfSamples;
+				std::vector<StatSim::SampleCoverage> coverages;
+				{
+					const auto timer = simulator.GetMetrics().Measure("EvaluateCoverage");
+					coverages = population->EvaluateCoverage(k, simulator.GetThreadPool());
+				}
+				for (const auto& coverage : coverages) {
+					std::cout << "n=" << coverage.SampleSize << "인 표본 " << coverage.SampleCount << "개\n";
+					for (int i = 0; i < kCount; ++i) {
+						const double reliability = StatSim::NormalCDF(k[i], 0, 1) - StatSim::NormalCDF(-k[i], 0, 1);
+						const double hit = coverage.HitRates[i], error = hit - reliability;
+						std::cout << "신뢰 상수 " << k[i] << " - 신뢰도: " << reliability << ", 적중 확률: " << hit << "(오차 " << error << ")\n";
 					}
 				}
+				break;
+			}
+
+			case 11: {
+				const int size = ReadInput<int>("표본의 크기");
+				if (size < 1 || size > data->GetSize()) {
+					std::cout << "올바르지 않은 크기입니다.\n";
+					break;
+				}
+				const int enableReplacement = ReadAction("추출 방법", 2, "1. 비복원 추출\n2. 복원 추출") - 1;
+				const int loop = ReadInput<int>("추출 횟수");
+				if (loop < 1) {
+					std::cout << "올바르지 않은 횟수입니다.\n";
+					break;
+				}
 
-				const double hit = count / static_cast<double>(numberOfSamples), error = hit - reliability;
-				std::cout << "ŷڵ: " << reliability << "\n Ȯ: " << hit << "( " << error << ")\n";
+				StatSim::Population* const population = static_cast<StatSim::Population*>(data);
+				StatSim::Population* sampleMeans;
+				{
+					const auto timer = simulator.GetMetrics().Measure("SimulateSampleMeans", static_cast<std::uint64_t>(size) * loop * sizeof(double));
+					sampleMeans = population->CreateSampleMeanPopulation(size, loop, enableReplacement, simulator.GetThreadPool());
+				}
+				PrintSampleMeans(sampleMeans);
+
+				if (ReadAction("저장", 2, "1. 저장하지 않기\n2. 파일로 저장하기") == 2) {
+					SavePopulation(simulator, sampleMeans);
+				}
+				delete sampleMeans;
 				break;
 			}
+
+			case 12:
+				PrintMemoryUsage(simulator);
+				break;
+
+			case 13:
+				PrintMetrics(simulator);
+				break;
+
+			case 14:
+				return 0;
 			}
 		} else {
-			switch (ReadAction("", 5, "1. \n2. Ȯ\n3. ǥ\n4.  \n5.  ")) {
+			switch (ReadAction("동작", 8, "1. 출력\n2. 확률분포\n3. 표본조사\n4. 모평균 추정\n5. 부트스트랩 신뢰구간\n6. 모집단 선택\n7. 성능 지표\n8. 종료")) {
 			case 1:
-				simulator.PrintSelectedData();
-				std::cout << '\n';
+				PrintSelectedData(simulator);
 				break;
 
 			case 2:
@@ -282,14 +379,14 @@ int main() {
 				StatSim::Population* const population = sample->GetPopulation();
 
 				const double statPopMean = population->GetMean(), statMean = data->GetMean(), errMean = statMean - statPopMean;
-				std::cout << " : " << statPopMean << "\n ǥ: " << statMean << "( " << errMean << ")\n";
+				std::cout << "통계적 모평균: " << statPopMean << "\n통계적 표본평균: " << statMean << "(오차 " << errMean << ")\n";
 
 				const double statPopVariance = population->GetVariance(), statVariance = data->GetVariance(), errVariance = statVariance - statPopVariance;
-				std::cout << " л: " << statPopVariance << "\n ǥл: " << statVariance << "( " << errVariance << ")\n";
+				std::cout << "통계적 모분산: " << statPopVariance << "\n통계적 표본분산: " << statVariance << "(오차 " << errVariance << ")\n";
 
 				const double statPopStandardDeviation = population->GetStandardDeviation(), statStandardDeviation = data->GetStandardDeviation(),
 					errStandardDeviation = statStandardDeviation - statPopStandardDeviation;
-				std::cout << " ǥ: " << statPopStandardDeviation << "\n ǥǥ: " << statStandardDeviation << "( " << errStandardDeviation << ")\n";
+				std::cout << "통계적 모표준편차: " << statPopStandardDeviation << "\n통계적 표본표준편차: " << statStandardDeviation << "(오차 " << errStandardDeviation << ")\n";
 				break;
 			}
 
@@ -301,13 +398,39 @@ int main() {
 				const double statStandardDeviation = data->GetStandardDeviation();
 				const double reliability = std::abs(StatSim::NormalCDF(statPopMean, statMean, statStandardDeviation) -
 					StatSim::NormalCDF(2 * statMean - statPopMean, statMean, statStandardDeviation)) * 100;
-				std::cout << " : " << statPopMean << "\n ǥ: " << statMean << "\nŷڵ " << reliability << "%     մϴ.\n";
+				std::cout << "통계적 모평균: " << statPopMean << "\n통계적 표본평균: " << statMean << "\n신뢰도 " << reliability << "% 구간 내에 통계적 모평균이 존재합니다.\n";
+				break;
+			}
+
+			case 5: {
+				const StatSim::BootstrapStatistic statistic = static_cast<StatSim::BootstrapStatistic>(
+					ReadAction("통계량", 3, "1. 평균\n2. 중앙값\n3. 분산") - 1);
+				const int replicateCount = ReadInput<int>("재표본 횟수");
+				const double confidence = ReadInput<double>("신뢰도(%)") / 100;
+				if (replicateCount < 2 || !(confidence > 0 && confidence < 1) || data->GetSize() < 3) {
+					std::cout << "올바르지 않은 입력입니다.\n";
+					break;
+				}
+
+				const auto timer = simulator.GetMetrics().Measure("Bootstrap");
+				const StatSim::BootstrapInterval result = static_cast<StatSim::Sample*>(data)->Bootstrap(statistic, replicateCount, confidence,
+					simulator.GetThreadPool());
+				std::cout << "추정값: " << result.Estimate << "\n표준오차: " << result.StandardError << '\n';
+				std::cout << "백분위수 구간: [" << result.Percentile.GetBegin() << ", " << result.Percentile.GetEnd() << "]\n";
+				std::cout << "BCa 구간: [" << result.BCa.GetBegin() << ", " << result.BCa.GetEnd() << "]\n";
 				break;
 			}
 
-			case 5:
+			case 6:
 				simulator.SelectPopulation();
 				break;
+
+			case 7:
+				PrintMetrics(simulator);
+				break;
+
+			case 8:
+				return 0;
 			}
 		}
 	}
@@ -318,8 +441,17 @@ int main() {
 template<typename T>
 T ReadInput(const char* name) {
 	std::cout << name << " >>> ";
+
+	// 형식이 틀리거나 T의 범위를 넘는 값은 다시 입력받습니다.
 	T result;
-	return std::cin >> result, result;
+	while (!(std::cin >> result)) {
+		if (std::cin.eof()) std::exit(EXIT_FAILURE);
+
+		std::cin.clear();
+		std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+		std::cout << "올바르지 않은 값입니다.\n" << name << " >>> ";
+	}
+	return result;
 }
 template<>
 std::string ReadInput<std::string>(const char* name) {
@@ -338,7 +470,212 @@ int ReadAction(const char* name, int max, const std::string_view& actions) {
 		std::cin >> result;
 
 		if (result < 1 || result > max) {
-			std::cout << "   Դϴ.";
+			std::cout << "알 수 없는 동작입니다.";
 		} else return result;
 	} while (true);
-}
\ No newline at end of file
+}
+std::int64_t ReadPopulationSize(std::int64_t max) {
+	// 메모리에 만드는 모집단은 int, 바이너리 파일로 만드는 모집단은 std::int64_t 크기까지 지원합니다.
+	do {
+		const std::int64_t result = ReadInput<std::int64_t>("모집단의 크기");
+		if (result < 1 || result > max) {
+			std::cout << "올바르지 않은 크기입니다.\n";
+		} else return result;
+	} while (true);
+}
+void PrintSampleMeans(StatSim::Population* sampleMeans) {
+	StatSim::Distribution* const sampleMeansDistribution = sampleMeans->GetDistribution();
+
+	const double mathMean = sampleMeansDistribution->GetMean(), statMean = sampleMeans->GetMean(), errMean = statMean - mathMean;
+	std::cout << "표본평균의 수학적 평균: " << mathMean << "\n표본평균의 통계적 평균: " << statMean << "(오차 " << errMean << ")\n";
+
+	const double mathVariance = sampleMeansDistribution->GetVariance(), statVariance = sampleMeans->GetVariance(),
+		errVariance = statVariance - mathVariance;
+	std::cout << "표본평균의 수학적 분산: " << mathVariance << "\n표본평균의 통계적 분산: " << statVariance << "(오차 " << errVariance << ")\n";
+
+	const double mathStandardDeviation = sampleMeansDistribution->GetStandardDeviation(), statStandardDeviation = sampleMeans->GetStandardDeviation(),
+		errStandardDeviation = statStandardDeviation - mathStandardDeviation;
+	std::cout << "표본평균의 수학적 표준편차: " << mathStandardDeviation << "\n표본평균의 통계적 표준편차: " << statStandardDeviation << "(오차 " << errStandardDeviation << ")\n";
+}
+void SavePopulation(StatSim::Simulator& simulator, StatSim::Population* population) {
+	const int format = ReadAction("파일 형식", 2, "1. 텍스트\n2. 바이너리");
+
+	std::cin.ignore();
+	const std::string path = ReadInput<std::string>("파일의 경로");
+	const auto timer = simulator.GetMetrics().Measure(format == 1 ? "SavePopulation" : "SaveBinaryPopulation",
+		static_cast<std::uint64_t>(population->GetSize()) * sizeof(double));
+	if (format == 1) {
+		population->Save(path, &simulator.GetThreadPool());
+	} else {
+		population->SaveBinary(path);
+	}
+}
+void PrintSelectedData(StatSim::Simulator& simulator) {
+	if (ReadAction("출력 범위", 2, "1. 전체\n2. 일부") == 1) {
+		simulator.PrintSelectedData();
+		std::cout << '\n';
+		return;
+	}
+
+	const std::int64_t size = simulator.GetSelectedData()->GetSize();
+	const std::int64_t begin = ReadInput<std::int64_t>("시작 번호");
+	const std::int64_t end = ReadInput<std::int64_t>("끝 번호(포함하지 않음)");
+	const int stride = ReadInput<int>("간격");
+	if (begin < 0 || begin > end || end > size || stride < 1) {
+		std::cout << "올바르지 않은 범위입니다.\n";
+		return;
+	}
+
+	simulator.PrintSelectedData(begin, end, stride);
+	std::cout << '\n';
+}
+void PrintMetrics(StatSim::Simulator& simulator) {
+	simulator.GetMetrics().Print(std::cout);
+
+	if (ReadAction("저장", 2, "1. 저장하지 않기\n2. 파일로 저장하기") == 2) {
+		std::cin.ignore();
+		simulator.GetMetrics().Save(ReadInput<std::string>("파일의 경로"));
+	}
+}
+void PrintMemoryUsage(StatSim::Simulator& simulator) {
+	const StatSim::Population* const population = static_cast<StatSim::Population*>(simulator.GetSelectedData());
+	const StatSim::PopulationMemoryUsage usage = population->GetMemoryUsage();
+	const std::size_t budget = population->GetMemoryBudget();
+	const auto toMegabytes = [](std::size_t size) {
+		return size / (1024.0 * 1024.0);
+	};
+
+	std::cout << "모집단의 값: " << toMegabytes(usage.ValueSize) << "MB\n표본과 요약 통계: " << toMegabytes(usage.SampleSize)
+		<< "MB\n표본의 인덱스: " << toMegabytes(usage.IndexSize) << "MB\n합계: " << toMegabytes(usage.TotalSize) << "MB\n예산: ";
+	if (budget == StatSim::Population::UnlimitedMemoryBudget) {
+		std::cout << "무제한\n";
+	} else {
+		std::cout << toMegabytes(budget) << "MB\n";
+	}
+	std::cout << "인덱스를 버린 표본: " << usage.EvictedSampleCount << "개(선택하면 다시 뽑습니다)\n";
+
+	if (ReadAction("예산", 2, "1. 바꾸지 않기\n2. 바꾸기") == 2) {
+		const double megabytes = ReadInput<double>("메모리 예산(MB, 0이면 무제한)");
+		if (!(megabytes >= 0)) {
+			std::cout << "올바르지 않은 입력입니다.\n";
+			return;
+		}
+		simulator.SetMemoryBudget(megabytes == 0 ? StatSim::Population::UnlimitedMemoryBudget : static_cast<std::size_t>(megabytes * 1024 * 1024));
+	}
+}
+int RunScenarios(int argc, char* argv[]) {
+	// 인자로 받은 시나리오를 차례로 실행합니다. 하나가 실패해도 나머지는 계속 실행합니다.
+	int result = 0;
+	for (int i = 1; i < argc; ++i) {
+		try {
+			const StatSim::Scenario scenario(argv[i]);
+			StatSim::Simulator simulator;
+			scenario.Run(simulator);
+		} catch (const std::exception& exception) {
+			std::cerr << argv[i] << ": " << exception.what() << '\n';
+			result = 1;
+		}
+	}
+	return result;
+}
+
+#ifdef STATSIM_COUNT_ALLOCATIONS
+// 성능 지표의 할당 횟수를 세기 위해 이 실행 파일에서만 전역 operator new와 delete를 모두 바꿉니다.
+// StatSimCore를 링크하는 다른 프로그램의 할당 방식은 바뀌지 않습니다.
+namespace {
+	void* Allocate(std::size_t size, std::size_t alignment) {
+		StatSim::Metrics::RecordAllocation(size);
+
+		size = (std::max<std::size_t>(size, 1) + alignment - 1) / alignment * alignment;
+		while (true) {
+#ifdef _WIN32
+			if (void* const pointer = _aligned_malloc(size, alignment)) return pointer;
+#else
+			if (void* const pointer = std::aligned_alloc(alignment, size)) return pointer;
+#endif
+
+			const std::new_handler handler = std::get_new_handler();
+			if (handler == nullptr) throw std::bad_alloc();
+			handler();
+		}
+	}
+	void* Allocate(std::size_t size, std::size_t alignment, const std::nothrow_t&) noexcept {
+		try {
+			return Allocate(size, alignment);
+		} catch (...) {
+			return nullptr;
+		}
+	}
+	void Deallocate(void* pointer) noexcept {
+#ifdef _WIN32
+		_aligned_free(pointer);
+#else
+		std::free(pointer);
+#endif
+	}
+
+	constexpr std::size_t DefaultAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+}
+
+void* operator new(std::size_t size) {
+	return Allocate(size, DefaultAlignment);
+}
+void* operator new[](std::size_t size) {
+	return Allocate(size, DefaultAlignment);
+}
+void* operator new(std::size_t size, const std::nothrow_t& tag) noexcept {
+	return Allocate(size, DefaultAlignment, tag);
+}
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+	return Allocate(size, DefaultAlignment, tag);
+}
+void* operator new(std::size_t size, std::align_val_t alignment) {
+	return Allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+	return Allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept {
+	return Allocate(size, static_cast<std::size_t>(alignment), tag);
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept {
+	return Allocate(size, static_cast<std::size_t>(alignment), tag);
+}
+
+void operator delete(void* pointer) noexcept {
+	Deallocate(pointer);
+}
+void operator delete[](void* pointer) noexcept {
+	Deallocate(pointer);
+}
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+	Deallocate(pointer);
+}
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+	Deallocate(pointer);
+}
+void operator delete(void* pointer, std::size_t) noexcept {
+	Deallocate(pointer);
+}
+void operator delete[](void* pointer, std::size_t) noexcept {
+	Deallocate(pointer);
+}
+void operator delete(void* pointer, std::align_val_t) noexcept {
+	Deallocate(pointer);
+}
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+	Deallocate(pointer);
+}
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+	Deallocate(pointer);
+}
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+	Deallocate(pointer);
+}
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+	Deallocate(pointer);
+}
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+	Deallocate(pointer);
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <StatSim/MappedFile.hpp>
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#	define NOMINMAX
+#	include <Windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace StatSim {
+#ifdef _WIN32
+	MappedFile::MappedFile(const std::string& path) {
+		m_File = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (m_File == INVALID_HANDLE_VALUE) throw std::runtime_error("failed to open the file");
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(m_File, &size)) {
+			CloseHandle(m_File);
+			throw std::runtime_error("failed to get the file size");
+		}
+
+		m_Size = static_cast<std::size_t>(size.QuadPart);
+		if (m_Size == 0) return;
+
+		m_Mapping = CreateFileMappingA(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (m_Mapping) {
+			m_Data = static_cast<const std::byte*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+		}
+		if (m_Data == nullptr) {
+			if (m_Mapping) {
+				CloseHandle(m_Mapping);
+			}
+			CloseHandle(m_File);
+			throw std::runtime_error("failed to map the file");
+		}
+	}
+	MappedFile::~MappedFile() {
+		if (m_Data) {
+			UnmapViewOfFile(m_Data);
+			CloseHandle(m_Mapping);
+		}
+		CloseHandle(m_File);
+	}
+#else
+	MappedFile::MappedFile(const std::string& path) {
+		const int file = open(path.c_str(), O_RDONLY);
+		if (file == -1) throw std::runtime_error("failed to open the file");
+
+		struct stat status;
+		if (fstat(file, &status) == -1) {
+			close(file);
+			throw std::runtime_error("failed to get the file size");
+		}
+
+		m_Size = static_cast<std::size_t>(status.st_size);
+		if (m_Size == 0) {
+			close(file);
+			return;
+		}
+
+		void* const address = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+		if (address == MAP_FAILED) throw std::runtime_error("failed to map the file");
+
+		madvise(address, m_Size, MADV_WILLNEED);
+		m_Data = static_cast<const std::byte*>(address);
+	}
+	MappedFile::~MappedFile() {
+		if (m_Data) {
+			munmap(const_cast<std::byte*>(m_Data), m_Size);
+		}
+	}
+#endif
+
+	const std::byte* MappedFile::GetData() const noexcept {
+		return m_Data;
+	}
+	std::size_t MappedFile::GetSize() const noexcept {
+		return m_Size;
+	}
+}
\ No newline at end of file
@@ -1,36 +1,119 @@
 #include <StatSim/Math.hpp>
 
-#include <boost/multiprecision/cpp_int.hpp>
-#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/erf.hpp>
 
+#include <cassert>
 #include <cmath>
 #include <numbers>
 
 namespace StatSim {
-	double BinomialPMF(int tryCount, int occurCount, double probability) {
-		const auto numberOfCases = [](int n, int r) {
-			if (n - r < r) {
-				r = n - r;
-			}
+	namespace {
+		// Loader(2000)의 안장점 전개에 쓰는 함수들입니다.
+		double StirlingError(double n) {
+			static constexpr double s0 = 1.0 / 12, s1 = 1.0 / 360, s2 = 1.0 / 1260, s3 = 1.0 / 1680, s4 = 1.0 / 1188;
 
-			boost::multiprecision::cpp_int result = 1;
-			for (int i = 0; i < r; ++i) {
-				result *= n - i;
-			}
-			for (int i = 0; i < r; ++i) {
-				result /= i + 1;
+			if (n <= 15) return std::lgamma(n + 1) - (n + 0.5) * std::log(n) + n - std::log(std::sqrt(2 * std::numbers::pi));
+
+			const double nn = n * n;
+			if (n > 500) return (s0 - s1 / nn) / n;
+			else if (n > 80) return (s0 - (s1 - s2 / nn) / nn) / n;
+			else if (n > 35) return (s0 - (s1 - (s2 - s3 / nn) / nn) / nn) / n;
+			else return (s0 - (s1 - (s2 - (s3 - s4 / nn) / nn) / nn) / nn) / n;
+		}
+		double DevianceTerm(double x, double np) {
+			if (std::abs(x - np) < 0.1 * (x + np)) {
+				double v = (x - np) / (x + np);
+				double s = (x - np) * v;
+				double ej = 2 * x * v;
+				v *= v;
+				for (int j = 1; j < 1000; ++j) {
+					ej *= v;
+					const double next = s + ej / (2 * j + 1);
+					if (next == s) return next;
+					s = next;
+				}
+				return s;
 			}
-			return result;
-		}(tryCount, occurCount);
+			return x * std::log(x / np) + np - x;
+		}
+	}
+
+	double BinomialPMF(int tryCount, int occurCount, double probability) {
+		if (occurCount < 0 || occurCount > tryCount) return 0;
+
+		const double n = tryCount, x = occurCount;
+		const double p = probability, q = 1 - probability;
+		if (p == 0) return occurCount == 0 ? 1 : 0;
+		else if (q == 0) return occurCount == tryCount ? 1 : 0;
+
+		if (occurCount == 0) {
+			if (tryCount == 0) return 1;
+			return std::exp(p < 0.1 ? -DevianceTerm(n, n * q) - n * p : n * std::log(q));
+		} else if (occurCount == tryCount) {
+			return std::exp(q < 0.1 ? -DevianceTerm(n, n * p) - n * q : n * std::log(p));
+		}
 
-		const boost::multiprecision::cpp_bin_float_100 probabilityEx(probability);
-		const auto occurProbability = boost::multiprecision::pow(probabilityEx, occurCount);
-		const auto notOccurProbability = boost::multiprecision::pow(1 - probabilityEx, tryCount - occurCount);
+		const double lc = StirlingError(n) - StirlingError(x) - StirlingError(n - x) - DevianceTerm(x, n * p) - DevianceTerm(n - x, n * q);
+		const double lf = std::log(2 * std::numbers::pi) + std::log(x) + std::log1p(-x / n);
+		return std::exp(lc - 0.5 * lf);
+	}
+	double BinomialCDF(int tryCount, int occurCount, double probability) {
+		if (occurCount < 0) return 0;
+		else if (occurCount >= tryCount) return 1;
+		else if (probability == 0) return 1;
+		else if (probability == 1) return 0;
+
+		return boost::math::ibetac(occurCount + 1.0, static_cast<double>(tryCount - occurCount), probability);
+	}
+	double BinomialSurvival(int tryCount, int occurCount, double probability) {
+		if (occurCount <= 0) return 1;
+		else if (occurCount > tryCount) return 0;
+		else if (probability == 0) return 0;
+		else if (probability == 1) return 1;
 
-		const auto result = static_cast<boost::multiprecision::cpp_bin_float_100>(numberOfCases) * occurProbability * notOccurProbability;
-		return static_cast<double>(result);
+		return boost::math::ibeta(static_cast<double>(occurCount), tryCount - occurCount + 1.0, probability);
 	}
 	double NormalCDF(double value, double mean, double standardDeviation) {
 		return 0.5 * std::erfc((mean - value) / standardDeviation / std::numbers::sqrt2_v<double>);
 	}
+	double NormalICDF(double probability, double mean, double standardDeviation) {
+		assert(0 < probability && probability < 1);
+
+		return mean - standardDeviation * std::numbers::sqrt2_v<double> * boost::math::erfc_inv(2 * probability);
+	}
+}
+
+namespace StatSim {
+	Moments::Moments(std::int64_t count, double mean, double squaredDeviationSum) noexcept
+		: m_Count(count), m_Mean(mean), m_SquaredDeviationSum(squaredDeviationSum) {}
+
+	void Moments::Add(double value) noexcept {
+		const double delta = value - m_Mean;
+		m_Mean += delta / ++m_Count;
+		m_SquaredDeviationSum += delta * (value - m_Mean);
+	}
+	void Moments::Merge(const Moments& moments) noexcept {
+		if (moments.m_Count == 0) return;
+		else if (m_Count == 0) {
+			*this = moments;
+			return;
+		}
+
+		const std::int64_t count = m_Count + moments.m_Count;
+		const double delta = moments.m_Mean - m_Mean;
+		m_Mean += delta * moments.m_Count / count;
+		m_SquaredDeviationSum += moments.m_SquaredDeviationSum + delta * delta * m_Count / count * moments.m_Count;
+		m_Count = count;
+	}
+
+	std::int64_t Moments::GetCount() const noexcept {
+		return m_Count;
+	}
+	double Moments::GetMean() const noexcept {
+		return m_Mean;
+	}
+	double Moments::GetSquaredDeviationSum() const noexcept {
+		return m_SquaredDeviationSum;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include <StatSim/Metrics.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <utility>
+
+namespace StatSim {
+	namespace {
+		std::atomic<std::uint64_t> g_AllocationCount = 0;
+		std::atomic<std::uint64_t> g_AllocatedByteCount = 0;
+	}
+}
+
+namespace StatSim {
+	std::uint64_t Metrics::Operation::GetLatencyPercentile(double percentile) const noexcept {
+		const std::uint64_t rank = static_cast<std::uint64_t>(percentile / 100 * CallCount);
+
+		std::uint64_t cumulativeCount = 0;
+		for (int i = 0; i < LatencyBucketCount; ++i) {
+			cumulativeCount += LatencyHistogram[i];
+			if (cumulativeCount > rank) return std::min(i + 1 < LatencyBucketCount ? static_cast<std::uint64_t>(2) << i : UINT64_MAX, MaxNanoseconds);
+		}
+		return MaxNanoseconds;
+	}
+
+	Metrics::Timer::Timer(Metrics& metrics, std::string name, std::uint64_t byteCount) noexcept
+		: m_Metrics(metrics), m_Name(std::move(name)), m_ByteCount(byteCount), m_Begin(std::chrono::steady_clock::now()),
+		m_AllocationCount(GetAllocationCount()), m_AllocatedByteCount(GetAllocatedByteCount()) {}
+	Metrics::Timer::~Timer() {
+		const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Begin).count();
+		m_Metrics.Record(m_Name, static_cast<std::uint64_t>(nanoseconds), m_ByteCount, GetAllocationCount() - m_AllocationCount,
+			GetAllocatedByteCount() - m_AllocatedByteCount);
+	}
+
+	void Metrics::Timer::AddBytes(std::uint64_t byteCount) noexcept {
+		m_ByteCount += byteCount;
+	}
+
+	Metrics::Timer Metrics::Measure(std::string name, std::uint64_t byteCount) {
+		return Timer(*this, std::move(name), byteCount);
+	}
+	void Metrics::Record(const std::string& name, std::uint64_t nanoseconds, std::uint64_t byteCount, std::uint64_t allocationCount,
+		std::uint64_t allocatedByteCount) {
+		const std::lock_guard lock(m_Mutex);
+
+		Operation& operation = m_Operations[name];
+		++operation.CallCount;
+		operation.TotalNanoseconds += nanoseconds;
+		operation.MaxNanoseconds = std::max(operation.MaxNanoseconds, nanoseconds);
+		operation.ByteCount += byteCount;
+		operation.AllocationCount += allocationCount;
+		operation.AllocatedByteCount += allocatedByteCount;
+		++operation.LatencyHistogram[nanoseconds == 0 ? 0 : std::bit_width(nanoseconds) - 1];
+	}
+	void Metrics::Reset() {
+		const std::lock_guard lock(m_Mutex);
+		m_Operations.clear();
+	}
+
+	std::map<std::string, Metrics::Operation> Metrics::GetOperations() const {
+		const std::lock_guard lock(m_Mutex);
+		return m_Operations;
+	}
+	void Metrics::Print(std::ostream& stream) const {
+		const auto operations = GetOperations();
+		const auto flags = stream.flags();
+		const auto precision = stream.precision();
+
+		stream << std::fixed << std::setprecision(3);
+		for (const auto& [name, operation] : operations) {
+			const double totalMilliseconds = operation.TotalNanoseconds / 1e6;
+			stream << name << ": " << operation.CallCount << "회, 총 " << totalMilliseconds << "ms, 평균 "
+				<< totalMilliseconds / operation.CallCount << "ms, p50 <= " << operation.GetLatencyPercentile(50) / 1e6 << "ms, p90 <= "
+				<< operation.GetLatencyPercentile(90) / 1e6 << "ms, p99 <= " << operation.GetLatencyPercentile(99) / 1e6 << "ms, 최대 "
+				<< operation.MaxNanoseconds / 1e6 << "ms";
+			if (operation.ByteCount > 0) {
+				stream << ", " << operation.ByteCount << "바이트(" << operation.ByteCount / 1e6 / (operation.TotalNanoseconds / 1e9) << "MB/s)";
+			}
+			if (IsAllocationCounted()) {
+				stream << ", 할당 " << operation.AllocationCount << "회(" << operation.AllocatedByteCount << "바이트)";
+			}
+			stream << '\n';
+		}
+
+		stream.flags(flags);
+		stream.precision(precision);
+	}
+	void Metrics::Save(const std::string& path) const {
+		const auto operations = GetOperations();
+
+		std::ofstream file(path);
+		if (!file) throw std::runtime_error("failed to open the file");
+
+		file << "{\n\t\"Operations\": [";
+		bool isFirst = true;
+		for (const auto& [name, operation] : operations) {
+			file << (isFirst ? "\n" : ",\n") << "\t\t{ \"Name\": \"" << name << "\", \"CallCount\": " << operation.CallCount
+				<< ", \"TotalNanoseconds\": " << operation.TotalNanoseconds << ", \"MaxNanoseconds\": " << operation.MaxNanoseconds
+				<< ", \"ByteCount\": " << operation.ByteCount;
+			if (IsAllocationCounted()) {
+				file << ", \"AllocationCount\": " << operation.AllocationCount << ", \"AllocatedByteCount\": " << operation.AllocatedByteCount;
+			}
+			file << ", \"LatencyHistogram\": [";
+			// 마지막으로 값이 있는 구간까지만 씁니다.
+			const auto last = std::find_if(operation.LatencyHistogram.rbegin(), operation.LatencyHistogram.rend(), [](std::uint64_t count) {
+				return count != 0;
+			}).base();
+			for (auto iter = operation.LatencyHistogram.begin(); iter != last; ++iter) {
+				file << (iter == operation.LatencyHistogram.begin() ? "" : ", ") << *iter;
+			}
+			file << "] }";
+			isFirst = false;
+		}
+		file << "\n\t]\n}\n";
+		if (!file) throw std::runtime_error("failed to write the file");
+	}
+
+	void Metrics::RecordAllocation(std::size_t size) noexcept {
+		g_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+		g_AllocatedByteCount.fetch_add(size, std::memory_order_relaxed);
+	}
+	bool Metrics::IsAllocationCounted() noexcept {
+		return GetAllocationCount() > 0;
+	}
+	std::uint64_t Metrics::GetAllocationCount() noexcept {
+		return g_AllocationCount.load(std::memory_order_relaxed);
+	}
+	std::uint64_t Metrics::GetAllocatedByteCount() noexcept {
+		return g_AllocatedByteCount.load(std::memory_order_relaxed);
+	}
+}
\ No newline at end of file
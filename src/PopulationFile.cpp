@@ -0,0 +1,158 @@
+#include <StatSim/PopulationFile.hpp>
+
+#include <StatSim/MappedFile.hpp>
+#include <StatSim/Sort.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace StatSim {
+	PopulationFileHeader PopulationFileHeader::Create(const Distribution* distribution, const Moments& moments) noexcept {
+		PopulationFileHeader header{};
+		std::memcpy(header.Magic, MagicValue, sizeof(header.Magic));
+		header.Version = CurrentVersion;
+		header.Flags = SortedFlag;
+		header.Size = static_cast<std::uint64_t>(moments.GetCount());
+		header.Mean = moments.GetMean();
+		header.SquaredDeviationSum = moments.GetSquaredDeviationSum();
+
+		if (const auto* const binomial = dynamic_cast<const BinomialDistribution*>(distribution); binomial) {
+			header.DistributionType = BinomialDistributionType;
+			header.DistributionParameters[0] = binomial->GetTryCount();
+			header.DistributionParameters[1] = binomial->GetProbability();
+		} else if (const auto* const normal = dynamic_cast<const NormalDistribution*>(distribution); normal) {
+			header.DistributionType = NormalDistributionType;
+			header.DistributionParameters[0] = normal->GetMean();
+			header.DistributionParameters[1] = normal->GetStandardDeviation();
+		}
+		return header;
+	}
+}
+
+namespace StatSim {
+	PopulationFileWriter::PopulationFileWriter(std::string path, std::size_t memoryBudget, ThreadPool* threadPool)
+		: m_Path(std::move(path)), m_ThreadPool(threadPool) {
+		if constexpr (std::endian::native != std::endian::little) throw std::runtime_error("unsupported byte order");
+
+		// 기수 정렬이 런과 같은 크기의 버퍼를 쓰므로 예산의 절반만 런에 씁니다.
+		m_RunSize = std::max(memoryBudget / (2 * sizeof(double)), MinRunSize);
+		m_Run.reserve(m_RunSize);
+	}
+	PopulationFileWriter::~PopulationFileWriter() {
+		for (const auto& runPath : m_RunPaths) {
+			std::error_code error;
+			std::filesystem::remove(runPath, error);
+		}
+	}
+
+	void PopulationFileWriter::Write(std::span<const double> values) {
+		while (!values.empty()) {
+			const std::size_t count = std::min(values.size(), m_RunSize - m_Run.size());
+			for (const double value : values.first(count)) {
+				m_Moments.Add(value);
+			}
+			m_Run.insert(m_Run.end(), values.begin(), values.begin() + count);
+			values = values.subspan(count);
+
+			if (m_Run.size() == m_RunSize) {
+				FlushRun();
+			}
+		}
+	}
+	void PopulationFileWriter::Finish(const Distribution* distribution) {
+		if (!m_Run.empty()) {
+			FlushRun();
+		}
+		std::vector<double>().swap(m_Run);
+
+		Merge(PopulationFileHeader::Create(distribution, m_Moments));
+	}
+	void PopulationFileWriter::Finish(DistributionGenerator* distributionGenerator) {
+		distributionGenerator->SetParameter("Mean", m_Moments.GetMean());
+		distributionGenerator->SetParameter("Variance", m_Moments.GetSquaredDeviationSum() / m_Moments.GetCount());
+
+		const std::unique_ptr<Distribution> distribution(distributionGenerator->Generate());
+		Finish(distribution.get());
+	}
+
+	std::uint64_t PopulationFileWriter::GetSize() const noexcept {
+		return static_cast<std::uint64_t>(m_Moments.GetCount());
+	}
+	const Moments& PopulationFileWriter::GetMoments() const noexcept {
+		return m_Moments;
+	}
+
+	void PopulationFileWriter::FlushRun() {
+		SortValues(m_Run, m_ThreadPool);
+
+		std::string runPath = m_Path + ".run" + std::to_string(m_RunPaths.size());
+		std::ofstream file(runPath, std::ios::binary);
+		if (!file) throw std::runtime_error("failed to open the file");
+
+		m_RunPaths.push_back(std::move(runPath));
+		file.write(reinterpret_cast<const char*>(m_Run.data()), static_cast<std::streamsize>(m_Run.size() * sizeof(double)));
+		if (!file) throw std::runtime_error("failed to write the file");
+
+		m_Run.clear();
+	}
+	void PopulationFileWriter::Merge(const PopulationFileHeader& header) {
+		std::ofstream file(m_Path, std::ios::binary);
+		if (!file) throw std::runtime_error("failed to open the file");
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		// 각 런에서 다음에 읽을 값을 최소 힙에 넣고, 가장 작은 값부터 꺼내 씁니다.
+		struct Cursor final {
+			const double* Current;
+			const double* End;
+		};
+		std::vector<std::unique_ptr<MappedFile>> runs;
+		std::vector<Cursor> cursors;
+		for (const auto& runPath : m_RunPaths) {
+			const auto& run = runs.emplace_back(std::make_unique<MappedFile>(runPath));
+			const double* const values = reinterpret_cast<const double*>(run->GetData());
+			if (run->GetSize() > 0) {
+				cursors.push_back({ values, values + run->GetSize() / sizeof(double) });
+			}
+		}
+
+		const auto compare = [&cursors](std::size_t a, std::size_t b) {
+			return *cursors[a].Current > *cursors[b].Current;
+		};
+		std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(compare)> heap(compare);
+		for (std::size_t i = 0; i < cursors.size(); ++i) {
+			heap.push(i);
+		}
+
+		std::vector<double> buffer;
+		buffer.reserve(MinRunSize);
+		while (!heap.empty()) {
+			const std::size_t i = heap.top();
+			heap.pop();
+
+			// 다음 런의 최솟값보다 크지 않은 동안은 힙을 거치지 않고 이어서 복사합니다.
+			Cursor& cursor = cursors[i];
+			const double limit = heap.empty() ? *(cursor.End - 1) : *cursors[heap.top()].Current;
+			do {
+				buffer.push_back(*cursor.Current++);
+				if (buffer.size() == MinRunSize) {
+					file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(double)));
+					buffer.clear();
+				}
+			} while (cursor.Current != cursor.End && *cursor.Current <= limit);
+
+			if (cursor.Current != cursor.End) {
+				heap.push(i);
+			}
+		}
+		file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(double)));
+		if (!file) throw std::runtime_error("failed to write the file");
+	}
+}
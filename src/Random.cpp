@@ -0,0 +1,125 @@
+#include <StatSim/Random.hpp>
+
+#include <atomic>
+#include <random>
+
+namespace StatSim {
+	namespace {
+		constexpr std::uint32_t PhiloxM0 = 0xD2511F53, PhiloxM1 = 0xCD9E8D57;
+		constexpr std::uint32_t PhiloxW0 = 0x9E3779B9, PhiloxW1 = 0xBB67AE85;
+		constexpr int PhiloxRoundCount = 10;
+
+		std::uint64_t Mix(std::uint64_t value) noexcept {
+			value += 0x9E3779B97F4A7C15;
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+			return value ^ (value >> 31);
+		}
+	}
+
+	Philox::Philox(std::uint64_t seed, std::uint64_t stream) noexcept
+		: m_Seed(seed), m_Stream(stream) {}
+
+	Philox::result_type Philox::operator()() noexcept {
+		if (m_BufferIndex == 2) {
+			m_Buffer = Generate(m_Block++);
+			m_BufferIndex = 0;
+		}
+		return m_Buffer[m_BufferIndex++];
+	}
+
+	void Philox::Fill(std::span<std::uint64_t> bits) noexcept {
+		std::size_t i = 0;
+		while (i < bits.size() && m_BufferIndex < 2) {
+			bits[i++] = m_Buffer[m_BufferIndex++];
+		}
+		for (; i + 2 * BatchBlockCount <= bits.size(); i += 2 * BatchBlockCount) {
+			GenerateBatch(m_Block, bits.data() + i);
+			m_Block += BatchBlockCount;
+		}
+		for (; i + 2 <= bits.size(); i += 2) {
+			const auto block = Generate(m_Block++);
+			bits[i] = block[0];
+			bits[i + 1] = block[1];
+		}
+		if (i < bits.size()) {
+			bits[i] = (*this)();
+		}
+	}
+	Philox Philox::Split(std::uint64_t index) const noexcept {
+		return Philox(m_Seed, Mix(m_Stream ^ Mix(index)));
+	}
+
+	std::uint64_t Philox::GetSeed() const noexcept {
+		return m_Seed;
+	}
+	std::uint64_t Philox::GetStream() const noexcept {
+		return m_Stream;
+	}
+
+	std::array<std::uint64_t, 2> Philox::Generate(std::uint64_t block) const noexcept {
+		// 카운터를 배열로 두면 라운드마다 스택을 거쳐 복사되므로 스칼라 변수로 계산합니다.
+		std::uint32_t counter0 = static_cast<std::uint32_t>(block), counter1 = static_cast<std::uint32_t>(block >> 32);
+		std::uint32_t counter2 = static_cast<std::uint32_t>(m_Stream), counter3 = static_cast<std::uint32_t>(m_Stream >> 32);
+		std::uint32_t key0 = static_cast<std::uint32_t>(m_Seed), key1 = static_cast<std::uint32_t>(m_Seed >> 32);
+
+		for (int round = 0; round < PhiloxRoundCount; ++round) {
+			const std::uint64_t product0 = static_cast<std::uint64_t>(PhiloxM0) * counter0;
+			const std::uint64_t product1 = static_cast<std::uint64_t>(PhiloxM1) * counter2;
+			counter0 = static_cast<std::uint32_t>(product1 >> 32) ^ counter1 ^ key0;
+			counter1 = static_cast<std::uint32_t>(product1);
+			counter2 = static_cast<std::uint32_t>(product0 >> 32) ^ counter3 ^ key1;
+			counter3 = static_cast<std::uint32_t>(product0);
+
+			key0 += PhiloxW0;
+			key1 += PhiloxW1;
+		}
+		return { static_cast<std::uint64_t>(counter1) << 32 | counter0, static_cast<std::uint64_t>(counter3) << 32 | counter2 };
+	}
+	void Philox::GenerateBatch(std::uint64_t block, std::uint64_t* bits) const noexcept {
+		// 한 블록의 라운드는 곱셈 지연 시간에 묶이므로, 여러 블록을 나란히 계산해 벡터화합니다.
+		// 32비트 값을 64비트 원소에 담아 두면 컴파일러가 32x32->64 곱셈 명령어를 그대로 씁니다.
+		std::uint64_t counter0[BatchBlockCount], counter1[BatchBlockCount], counter2[BatchBlockCount], counter3[BatchBlockCount];
+		for (int lane = 0; lane < BatchBlockCount; ++lane) {
+			counter0[lane] = static_cast<std::uint32_t>(block + lane);
+			counter1[lane] = static_cast<std::uint32_t>((block + lane) >> 32);
+			counter2[lane] = static_cast<std::uint32_t>(m_Stream);
+			counter3[lane] = static_cast<std::uint32_t>(m_Stream >> 32);
+		}
+		std::uint64_t key0 = static_cast<std::uint32_t>(m_Seed), key1 = static_cast<std::uint32_t>(m_Seed >> 32);
+
+		for (int round = 0; round < PhiloxRoundCount; ++round) {
+			for (int lane = 0; lane < BatchBlockCount; ++lane) {
+				const std::uint64_t product0 = PhiloxM0 * counter0[lane];
+				const std::uint64_t product1 = PhiloxM1 * counter2[lane];
+				counter0[lane] = (product1 >> 32) ^ counter1[lane] ^ key0;
+				counter1[lane] = product1 & UINT32_MAX;
+				counter2[lane] = (product0 >> 32) ^ counter3[lane] ^ key1;
+				counter3[lane] = product0 & UINT32_MAX;
+			}
+
+			key0 = (key0 + PhiloxW0) & UINT32_MAX;
+			key1 = (key1 + PhiloxW1) & UINT32_MAX;
+		}
+		for (int lane = 0; lane < BatchBlockCount; ++lane) {
+			bits[2 * lane] = counter1[lane] << 32 | counter0[lane];
+			bits[2 * lane + 1] = counter3[lane] << 32 | counter2[lane];
+		}
+	}
+}
+
+namespace StatSim {
+	static std::atomic<std::uint64_t> g_GlobalSeed = (static_cast<std::uint64_t>(std::random_device{}()) << 32) | std::random_device{}();
+	static std::atomic<std::uint64_t> g_NextStream = 0;
+
+	std::uint64_t GetGlobalSeed() noexcept {
+		return g_GlobalSeed.load();
+	}
+	void SetGlobalSeed(std::uint64_t seed) noexcept {
+		g_GlobalSeed.store(seed);
+		g_NextStream.store(0);
+	}
+	RandomEngine CreateRandomEngine() noexcept {
+		return RandomEngine(g_GlobalSeed.load()).Split(g_NextStream.fetch_add(1));
+	}
+}
@@ -0,0 +1,317 @@
+#include <StatSim/Sampler.hpp>
+
+#include <StatSim/Math.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__linux__)
+#	define STATSIM_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#	define STATSIM_TARGET_CLONES
+#endif
+
+namespace StatSim {
+	namespace {
+		constexpr int ZigguratLayerCount = 256;
+		constexpr double ZigguratR = 3.6541528853610088;
+		constexpr double ZigguratV = 0.00492867323399;
+		constexpr std::size_t NormalBlockSize = 1024;
+
+		// Doornik(2005)의 ZIGNOR 표입니다. 0층은 꼬리를 포함한 밑층입니다.
+		struct ZigguratTable final {
+			std::array<double, ZigguratLayerCount + 1> X;
+			std::array<double, ZigguratLayerCount> Ratio;
+
+			ZigguratTable() noexcept {
+				double f = std::exp(-0.5 * ZigguratR * ZigguratR);
+				X[0] = ZigguratV / f;
+				X[1] = ZigguratR;
+				X[ZigguratLayerCount] = 0;
+				for (int i = 2; i < ZigguratLayerCount; ++i) {
+					X[i] = std::sqrt(-2 * std::log(ZigguratV / X[i - 1] + f));
+					f = std::exp(-0.5 * X[i] * X[i]);
+				}
+				for (int i = 0; i < ZigguratLayerCount; ++i) {
+					Ratio[i] = X[i + 1] / X[i];
+				}
+			}
+		};
+		const ZigguratTable g_ZigguratTable;
+
+		double ToUniform(std::uint64_t bits) noexcept {
+			return static_cast<double>(bits >> 11) * 0x1.0p-53;
+		}
+
+		// 하위 8비트는 층, 상위 53비트는 [-1, 1)의 균등난수입니다. 거부되면 rejected에 1을 씁니다.
+		STATSIM_TARGET_CLONES
+		void ZigguratFastPath(const std::uint64_t* bits, double* values, std::uint8_t* rejected, std::size_t count) noexcept {
+			const double* const x = g_ZigguratTable.X.data();
+			const double* const ratio = g_ZigguratTable.Ratio.data();
+			for (std::size_t i = 0; i < count; ++i) {
+				const std::size_t layer = bits[i] & (ZigguratLayerCount - 1);
+				const double u = 2 * ToUniform(bits[i]) - 1;
+				values[i] = u * x[layer];
+				rejected[i] = std::abs(u) >= ratio[layer];
+			}
+		}
+		double ZigguratSlowPath(std::uint64_t bits, const RandomBitsFunction& random) {
+			std::array<std::uint64_t, 2> next;
+			while (true) {
+				const std::size_t layer = bits & (ZigguratLayerCount - 1);
+				const double u = 2 * ToUniform(bits) - 1;
+				if (std::abs(u) < g_ZigguratTable.Ratio[layer]) return u * g_ZigguratTable.X[layer];
+
+				if (layer == 0) {
+					// Marsaglia의 방법으로 R 바깥의 꼬리에서 뽑습니다.
+					double x, y;
+					do {
+						random(next);
+						x = std::log(1 - ToUniform(next[0])) / ZigguratR;
+						y = std::log(1 - ToUniform(next[1]));
+					} while (-2 * y < x * x);
+					return u < 0 ? x - ZigguratR : ZigguratR - x;
+				}
+
+				const double x = u * g_ZigguratTable.X[layer];
+				const double f0 = std::exp(-0.5 * (g_ZigguratTable.X[layer] * g_ZigguratTable.X[layer] - x * x));
+				const double f1 = std::exp(-0.5 * (g_ZigguratTable.X[layer + 1] * g_ZigguratTable.X[layer + 1] - x * x));
+				random(next);
+				if (f1 + ToUniform(next[0]) * (f0 - f1) < 1) return x;
+
+				bits = next[1];
+			}
+		}
+	}
+
+	void GenerateStandardNormal(std::span<double> values, const RandomBitsFunction& random) {
+		std::array<std::uint64_t, NormalBlockSize> bits;
+		std::array<std::uint8_t, NormalBlockSize> rejected;
+
+		for (std::size_t first = 0; first < values.size(); first += NormalBlockSize) {
+			const std::size_t count = std::min(NormalBlockSize, values.size() - first);
+			double* const block = values.data() + first;
+
+			random(std::span<std::uint64_t>(bits.data(), count));
+			ZigguratFastPath(bits.data(), block, rejected.data(), count);
+			for (std::size_t i = 0; i < count; ++i) {
+				if (rejected[i]) {
+					block[i] = ZigguratSlowPath(bits[i], random);
+				}
+			}
+		}
+	}
+}
+
+
+namespace StatSim {
+	namespace {
+		// 필요한 만큼씩 64비트 난수를 받아 두고 하나씩 꺼내 씁니다.
+		class RandomBitsBuffer final {
+		private:
+			const RandomBitsFunction& m_Random;
+			std::array<std::uint64_t, 256> m_Bits;
+			std::size_t m_Position = 0, m_Size = 0;
+
+		public:
+			explicit RandomBitsBuffer(const RandomBitsFunction& random) noexcept
+				: m_Random(random) {}
+			RandomBitsBuffer(const RandomBitsBuffer&) = delete;
+			~RandomBitsBuffer() = default;
+
+		public:
+			RandomBitsBuffer& operator=(const RandomBitsBuffer&) = delete;
+
+		public:
+			std::size_t GetAvailableCount() const noexcept {
+				return m_Size - m_Position;
+			}
+			void Refill(std::size_t count) {
+				std::copy(m_Bits.begin() + m_Position, m_Bits.begin() + m_Size, m_Bits.begin());
+				m_Size -= m_Position;
+				m_Position = 0;
+
+				const std::size_t newSize = std::min(m_Bits.size(), m_Size + std::max<std::size_t>(count, 1));
+				m_Random(std::span<std::uint64_t>(m_Bits.data() + m_Size, newSize - m_Size));
+				m_Size = newSize;
+			}
+			double NextUniform() {
+				if (m_Position == m_Size) {
+					Refill(2);
+				}
+				return ToUniform(m_Bits[m_Position++]);
+			}
+		};
+	}
+
+	BinomialSampler::BinomialSampler(int tryCount, double probability)
+		: m_TryCount(tryCount), m_Probability(probability) {
+		assert(tryCount >= 0);
+		assert(0 <= probability && probability <= 1);
+
+		if (tryCount == 0 || probability == 0 || probability == 1) return;
+
+		// 평균에서 표준편차의 12배보다 더 떨어진 값의 확률은 배정밀도에서 무시할 만합니다.
+		const double mean = tryCount * probability;
+		const double standardDeviation = std::sqrt(mean * (1 - probability));
+		const int begin = static_cast<int>(std::max(std::floor(mean - 12 * standardDeviation - 20), 0.0));
+		const int end = static_cast<int>(std::min(std::ceil(mean + 12 * standardDeviation + 20), static_cast<double>(tryCount)));
+		if (end - begin + 1 <= MaxTableSize) {
+			m_TableBegin = begin;
+			m_CDF.resize(end - begin + 1);
+
+			double sum = 0, compensation = 0;
+			for (int i = begin; i <= end; ++i) {
+				const double y = BinomialPMF(tryCount, i, probability) - compensation;
+				const double t = sum + y;
+				compensation = (t - sum) - y;
+				sum = t;
+				m_CDF[i - begin] = sum;
+			}
+			for (double& value : m_CDF) {
+				value /= sum;
+			}
+			m_CDF.back() = 1;
+
+			m_Guide.resize(m_CDF.size());
+			for (std::size_t i = 0, k = 0; i < m_Guide.size(); ++i) {
+				const double u = static_cast<double>(i) / m_Guide.size();
+				while (m_CDF[k] <= u) {
+					++k;
+				}
+				m_Guide[i] = static_cast<int>(k);
+			}
+			return;
+		}
+
+		m_R = std::min(probability, 1 - probability);
+		m_Q = 1 - m_R;
+		m_NRQ = tryCount * m_R * m_Q;
+		m_FM = tryCount * m_R + m_R;
+		m_M = static_cast<int>(std::floor(m_FM));
+		m_P1 = std::floor(2.195 * std::sqrt(m_NRQ) - 4.6 * m_Q) + 0.5;
+		m_XM = m_M + 0.5;
+		m_XL = m_XM - m_P1;
+		m_XR = m_XM + m_P1;
+		m_C = 0.134 + 20.5 / (15.3 + m_M);
+
+		double a = (m_FM - m_XL) / (m_FM - m_XL * m_R);
+		m_LambdaL = a * (1 + a / 2);
+		a = (m_XR - m_FM) / (m_XR * m_Q);
+		m_LambdaR = a * (1 + a / 2);
+
+		m_P2 = m_P1 * (1 + 2 * m_C);
+		m_P3 = m_P2 + m_C / m_LambdaL;
+		m_P4 = m_P3 + m_C / m_LambdaR;
+	}
+
+	void BinomialSampler::Generate(std::span<double> values, const RandomBitsFunction& random) const {
+		if (m_TryCount == 0 || m_Probability == 0) {
+			std::fill(values.begin(), values.end(), 0.0);
+		} else if (m_Probability == 1) {
+			std::fill(values.begin(), values.end(), static_cast<double>(m_TryCount));
+		} else if (IsTabulated()) {
+			GenerateFromTable(values, random);
+		} else {
+			GenerateBTPE(values, random);
+		}
+	}
+	bool BinomialSampler::IsTabulated() const noexcept {
+		return !m_CDF.empty();
+	}
+
+	void BinomialSampler::GenerateFromTable(std::span<double> values, const RandomBitsFunction& random) const {
+		std::array<std::uint64_t, NormalBlockSize> bits;
+
+		for (std::size_t first = 0; first < values.size(); first += NormalBlockSize) {
+			const std::size_t count = std::min(NormalBlockSize, values.size() - first);
+			random(std::span<std::uint64_t>(bits.data(), count));
+
+			for (std::size_t i = 0; i < count; ++i) {
+				const double u = ToUniform(bits[i]);
+				std::size_t k = m_Guide[static_cast<std::size_t>(u * m_Guide.size())];
+				while (m_CDF[k] <= u) {
+					++k;
+				}
+				values[first + i] = static_cast<double>(m_TableBegin + static_cast<int>(k));
+			}
+		}
+	}
+	void BinomialSampler::GenerateBTPE(std::span<double> values, const RandomBitsFunction& random) const {
+		const double n = m_TryCount, m = m_M;
+		RandomBitsBuffer buffer(random);
+
+		for (std::size_t i = 0; i < values.size(); ++i) {
+			// 값 하나에 평균적으로 균등난수가 세 개 이하로 필요하므로 남은 개수에 맞춰 미리 받아 둡니다.
+			if (buffer.GetAvailableCount() < 2) {
+				buffer.Refill(3 * (values.size() - i));
+			}
+
+			double y;
+			while (true) {
+				const double u = buffer.NextUniform() * m_P4;
+				double v = buffer.NextUniform();
+
+				// 가운데의 삼각형 영역은 바로 받아들입니다.
+				if (u <= m_P1) {
+					y = std::floor(m_XM - m_P1 * v + u);
+					break;
+				}
+
+				if (u <= m_P2) {
+					const double x = m_XL + (u - m_P1) / m_C;
+					v = v * m_C + 1 - std::abs(m - x + 0.5) / m_P1;
+					if (v > 1) continue;
+					y = std::floor(x);
+				} else if (u <= m_P3) {
+					y = std::floor(m_XL + std::log(v) / m_LambdaL);
+					if (y < 0) continue;
+					v *= (u - m_P2) * m_LambdaL;
+				} else {
+					y = std::floor(m_XR - std::log(v) / m_LambdaR);
+					if (y > n) continue;
+					v *= (u - m_P3) * m_LambdaR;
+				}
+
+				const double k = std::abs(y - m);
+				if (k <= 20 || k >= m_NRQ / 2 - 1) {
+					// 최빈값에서 y까지 확률의 비를 곱해 정확히 비교합니다.
+					const double s = m_R / m_Q, a = s * (n + 1);
+					double f = 1;
+					if (m < y) {
+						for (double i = m + 1; i <= y; ++i) {
+							f *= a / i - s;
+						}
+					} else if (m > y) {
+						for (double i = y + 1; i <= m; ++i) {
+							f /= a / i - s;
+						}
+					}
+					if (v > f) continue;
+					break;
+				}
+
+				// 정규 근사로 먼저 걸러 내고, 애매하면 Stirling 근사로 비교합니다.
+				const double rho = (k / m_NRQ) * ((k * (k / 3 + 0.625) + 1.0 / 6) / m_NRQ + 0.5);
+				const double t = -k * k / (2 * m_NRQ);
+				const double logV = std::log(v);
+				if (logV < t - rho) break;
+				if (logV > t + rho) continue;
+
+				const double x1 = y + 1, f1 = m + 1, z = n + 1 - m, w = n - y + 1;
+				const auto correction = [](double x) {
+					const double x2 = x * x;
+					return (13860 - (462 - (132 - (99 - 140 / x2) / x2) / x2) / x2) / x / 166320;
+				};
+				const double bound = m_XM * std::log(f1 / x1) + (n - m + 0.5) * std::log(z / w) + (y - m) * std::log(w * m_R / (x1 * m_Q)) +
+					correction(f1) + correction(z) + correction(x1) + correction(w);
+				if (logV > bound) continue;
+				break;
+			}
+
+			values[i] = m_Probability > 0.5 ? n - y : y;
+		}
+	}
+}
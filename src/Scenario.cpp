@@ -0,0 +1,264 @@
+#include <StatSim/Scenario.hpp>
+
+#include <boost/property_tree/ini_parser.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+namespace StatSim {
+	namespace {
+		template<typename T>
+		std::vector<T> GetList(const boost::property_tree::ptree& tree, const std::string& path) {
+			const auto node = tree.get_child_optional(path);
+			if (!node) return {};
+
+			std::vector<T> result;
+			if (!node->empty()) {
+				for (const auto& [key, child] : *node) {
+					result.push_back(child.template get_value<T>());
+				}
+			} else {
+				std::string text = node->data();
+				std::replace(text.begin(), text.end(), ',', ' ');
+
+				std::istringstream stream(text);
+				for (T value; stream >> value;) {
+					result.push_back(value);
+				}
+				if (!stream.eof()) throw std::runtime_error("invalid list in the scenario: " + path);
+			}
+			return result;
+		}
+
+		std::string FormatNumber(double value) {
+			// 개수처럼 정수인 값은 지수 표기 없이 씁니다.
+			char text[32];
+			if (value == std::trunc(value) && std::abs(value) < 0x1p53) {
+				return std::string(text, std::to_chars(text, text + sizeof(text), static_cast<std::int64_t>(value)).ptr);
+			}
+			return std::string(text, std::to_chars(text, text + sizeof(text), value).ptr);
+		}
+	}
+
+	Scenario::Scenario(const std::string& path) {
+		boost::property_tree::ptree tree;
+		if (path.ends_with(".json")) {
+			boost::property_tree::read_json(path, tree);
+		} else {
+			boost::property_tree::read_ini(path, tree);
+		}
+
+		if (const auto seed = tree.get_optional<std::uint64_t>("Seed")) {
+			m_Seed = *seed;
+		}
+
+		m_DistributionType = tree.get<std::string>("Distribution.Type");
+		m_ProgramPath = tree.get("Distribution.Path", "");
+		for (const auto& [key, child] : tree.get_child("Distribution")) {
+			if (key == "Type" || key == "Path") continue;
+
+			m_DistributionParameters.emplace_back(key, child.get_value<double>());
+		}
+
+		m_PopulationSource = tree.get("Population.Source", "Distribution");
+		m_PopulationPath = tree.get("Population.Path", "");
+		m_BinaryPopulationPath = tree.get("Population.BinaryPath", "");
+		if (const auto node = tree.get_child_optional("Population.Size")) {
+			// 범위를 넘는 값은 get_value_optional이 거부합니다.
+			const auto size = node->get_value_optional<std::int64_t>();
+			if (!size) throw std::runtime_error("invalid population size in the scenario");
+			m_PopulationSize = *size;
+		}
+		m_MemoryBudget = tree.get("Population.MemoryBudget", 0.0);
+
+		m_SampleSizes = GetList<int>(tree, "Sampling.Sizes");
+		m_SampleCount = tree.get("Sampling.Count", 0);
+		m_EnableReplacement = tree.get("Sampling.Replacement", true);
+
+		m_SummarizeSampleMeans = tree.get("Statistics.SampleMeans", false);
+		m_CoverageK = GetList<double>(tree, "Statistics.Coverage");
+
+		m_CSVPath = tree.get("Output.CSV", "");
+		m_JSONPath = tree.get("Output.JSON", "");
+		m_PopulationOutputPath = tree.get("Output.Population", "");
+		m_BinaryPopulationOutputPath = tree.get("Output.BinaryPopulation", "");
+		m_MetricsPath = tree.get("Output.Metrics", "");
+
+		if ((m_PopulationSource == "Distribution" || m_PopulationSource == "BinaryDistribution") && m_PopulationSize < 1) {
+			throw std::runtime_error("invalid population size in the scenario");
+		}
+		// 메모리에 만드는 모집단은 int 크기까지만 지원하므로, 그보다 크면 BinaryDistribution으로 만들어야 합니다.
+		if (m_PopulationSource == "Distribution" && m_PopulationSize > std::numeric_limits<int>::max()) {
+			throw std::runtime_error("invalid population size in the scenario");
+		}
+		if (m_MemoryBudget < 0) throw std::runtime_error("invalid memory budget in the scenario");
+		if (m_SampleCount < 0) throw std::runtime_error("invalid sample count in the scenario");
+		// 표본이 하나도 없으면 표본평균의 분산과 적중 확률이 0/0이 되므로, 이를 요청했다면 Sampling.Count가 있어야 합니다.
+		if ((m_SummarizeSampleMeans || !m_CoverageK.empty()) && !m_SampleSizes.empty() && m_SampleCount < 1) {
+			throw std::runtime_error("invalid sample count in the scenario");
+		}
+		for (const int size : m_SampleSizes) {
+			if (size < 1) throw std::runtime_error("invalid sample size in the scenario");
+		}
+		for (const double k : m_CoverageK) {
+			if (!(k > 0)) throw std::runtime_error("invalid coverage constant in the scenario");
+		}
+	}
+
+	void Scenario::Run(Simulator& simulator) const {
+		const std::uint64_t seed = m_Seed.value_or(GetGlobalSeed());
+		SetGlobalSeed(seed);
+		if (!m_MetricsPath.empty()) {
+			simulator.SetMetricsPath(m_MetricsPath);
+		}
+		if (m_MemoryBudget > 0) {
+			simulator.SetMemoryBudget(static_cast<std::size_t>(m_MemoryBudget * 1024 * 1024));
+		}
+		Metrics& metrics = simulator.GetMetrics();
+
+		LoadPopulation(simulator);
+		simulator.SelectPopulation();
+
+		Population* const population = static_cast<Population*>(simulator.GetSelectedData());
+		ThreadPool& threadPool = simulator.GetThreadPool();
+		for (const int size : m_SampleSizes) {
+			if (size > population->GetSize()) throw std::runtime_error("invalid sample size in the scenario");
+		}
+
+		std::vector<Result> results;
+		results.push_back({ "PopulationSize", std::nullopt, std::nullopt, static_cast<double>(population->GetSize()) });
+		results.push_back({ "PopulationMean", std::nullopt, std::nullopt, population->GetMean() });
+		results.push_back({ "PopulationVariance", std::nullopt, std::nullopt, population->GetVariance() });
+
+		if (m_SummarizeSampleMeans) {
+			const Distribution* const distribution = population->GetDistribution();
+			for (const int size : m_SampleSizes) {
+				const auto timer = metrics.Measure("SummarizeSampleMeans", static_cast<std::uint64_t>(size) * m_SampleCount * sizeof(double));
+				const Moments moments = population->SummarizeSampleMeans(size, m_SampleCount, m_EnableReplacement, threadPool);
+				results.push_back({ "SampleMeanMean", size, std::nullopt, moments.GetMean() });
+				results.push_back({ "SampleMeanVariance", size, std::nullopt, moments.GetSquaredDeviationSum() / moments.GetCount() });
+				if (distribution) {
+					results.push_back({ "SampleMeanExpectedMean", size, std::nullopt, distribution->GetMean() });
+					results.push_back({ "SampleMeanExpectedVariance", size, std::nullopt, distribution->GetVariance() / size });
+				}
+			}
+		}
+
+		if (!m_CoverageK.empty()) {
+			for (const int size : m_SampleSizes) {
+				const auto timer = metrics.Measure("SampleBatch", static_cast<std::uint64_t>(size) * m_SampleCount * population->GetIndexWidth());
+				population->SampleBatch(size, m_SampleCount, m_EnableReplacement, threadPool);
+			}
+
+			std::vector<SampleCoverage> coverages;
+			{
+				const auto timer = metrics.Measure("EvaluateCoverage");
+				coverages = population->EvaluateCoverage(m_CoverageK, threadPool);
+			}
+			for (const SampleCoverage& coverage : coverages) {
+				results.push_back({ "SampleCount", coverage.SampleSize, std::nullopt, static_cast<double>(coverage.SampleCount) });
+				for (std::size_t i = 0; i < m_CoverageK.size(); ++i) {
+					const double k = m_CoverageK[i];
+					results.push_back({ "ConfidenceLevel", coverage.SampleSize, k, NormalCDF(k, 0, 1) - NormalCDF(-k, 0, 1) });
+					results.push_back({ "Coverage", coverage.SampleSize, k, coverage.HitRates[i] });
+				}
+			}
+		}
+
+		const std::uint64_t populationByteCount = static_cast<std::uint64_t>(population->GetSize()) * sizeof(double);
+		if (!m_PopulationOutputPath.empty()) {
+			const auto timer = metrics.Measure("SavePopulation", populationByteCount);
+			population->Save(m_PopulationOutputPath, &threadPool);
+		}
+		if (!m_BinaryPopulationOutputPath.empty()) {
+			const auto timer = metrics.Measure("SaveBinaryPopulation", populationByteCount);
+			population->SaveBinary(m_BinaryPopulationOutputPath);
+		}
+
+		if (!m_CSVPath.empty()) {
+			std::ofstream file(m_CSVPath);
+			if (!file) throw std::runtime_error("failed to open the file");
+			WriteCSV(file, seed, results);
+			if (!file) throw std::runtime_error("failed to write the file");
+		}
+		if (!m_JSONPath.empty()) {
+			std::ofstream file(m_JSONPath);
+			if (!file) throw std::runtime_error("failed to open the file");
+			WriteJSON(file, seed, results);
+			if (!file) throw std::runtime_error("failed to write the file");
+		}
+	}
+
+	DistributionGenerator* Scenario::CreateDistributionGenerator() const {
+		std::unique_ptr<DistributionGenerator> distributionGenerator;
+		if (m_DistributionType == "Binomial") {
+			distributionGenerator = std::make_unique<BinomialDistributionGenerator>();
+		} else if (m_DistributionType == "Normal") {
+			distributionGenerator = std::make_unique<NormalDistributionGenerator>();
+		} else if (m_DistributionType == "Program") {
+			distributionGenerator = std::make_unique<ProgramDistributionGenerator>(m_ProgramPath);
+		} else throw std::runtime_error("unknown distribution in the scenario");
+
+		for (const auto& [name, value] : m_DistributionParameters) {
+			distributionGenerator->SetParameter(name, value);
+		}
+		return distributionGenerator.release();
+	}
+	void Scenario::LoadPopulation(Simulator& simulator) const {
+		const std::unique_ptr<DistributionGenerator> distributionGenerator(CreateDistributionGenerator());
+		if (m_PopulationSource == "Distribution") {
+			simulator.GeneratePopulation(static_cast<int>(m_PopulationSize), distributionGenerator->Generate());
+		} else if (m_PopulationSource == "Text") {
+			simulator.LoadPopulation(m_PopulationPath, distributionGenerator.get());
+		} else if (m_PopulationSource == "Binary") {
+			simulator.LoadBinaryPopulation(m_PopulationPath, distributionGenerator.get());
+		} else if (m_PopulationSource == "BinaryDistribution") {
+			simulator.GenerateBinaryPopulation(m_PopulationPath, m_PopulationSize, distributionGenerator.get());
+		} else if (m_PopulationSource == "ConvertText") {
+			simulator.ConvertPopulation(m_PopulationPath, m_BinaryPopulationPath, distributionGenerator.get());
+		} else throw std::runtime_error("unknown population source in the scenario");
+	}
+
+	void Scenario::WriteCSV(std::ostream& stream, std::uint64_t seed, const std::vector<Result>& results) {
+		stream << "Seed,Statistic,SampleSize,K,Value\n";
+		for (const Result& result : results) {
+			stream << seed << ',' << result.Statistic << ',';
+			if (result.SampleSize) {
+				stream << *result.SampleSize;
+			}
+			stream << ',';
+			if (result.K) {
+				stream << FormatNumber(*result.K);
+			}
+			stream << ',' << FormatNumber(result.Value) << '\n';
+		}
+	}
+	void Scenario::WriteJSON(std::ostream& stream, std::uint64_t seed, const std::vector<Result>& results) {
+		// JSON에는 NaN과 무한대가 없으므로 null로 씁니다.
+		const auto formatNumber = [](double value) {
+			return std::isfinite(value) ? FormatNumber(value) : "null";
+		};
+
+		stream << "{\n\t\"Seed\": " << seed << ",\n\t\"Results\": [";
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			const Result& result = results[i];
+			stream << (i == 0 ? "\n" : ",\n") << "\t\t{ \"Statistic\": \"" << result.Statistic << '"';
+			if (result.SampleSize) {
+				stream << ", \"SampleSize\": " << *result.SampleSize;
+			}
+			if (result.K) {
+				stream << ", \"K\": " << formatNumber(*result.K);
+			}
+			stream << ", \"Value\": " << formatNumber(result.Value) << " }";
+		}
+		stream << "\n\t]\n}\n";
+	}
+}
\ No newline at end of file
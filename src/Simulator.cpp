@@ -1,20 +1,64 @@
 #include <StatSim/Simulator.hpp>
 
+#include <StatSim/DataWriter.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <exception>
 #include <iostream>
+#include <memory>
+#include <utility>
 
 namespace StatSim {
 	Simulator::~Simulator() {
 		delete m_Population;
+
+		if (!m_MetricsPath.empty()) {
+			try {
+				m_Metrics.Save(m_MetricsPath);
+			} catch (const std::exception& exception) {
+				std::cerr << exception.what() << '\n';
+			}
+		}
 	}
 
 	void Simulator::GeneratePopulation(int size, Distribution* distribution) {
-		m_Population = new Population(size, distribution);
+		const auto timer = m_Metrics.Measure("GeneratePopulation", static_cast<std::uint64_t>(size) * sizeof(double));
+		m_Population = new Population(size, distribution, &m_ThreadPool);
+		m_Population->SetMemoryBudget(m_MemoryBudget);
 		SelectPopulation();
 	}
 	void Simulator::LoadPopulation(const std::string& path, DistributionGenerator* distributionGenerator) {
-		m_Population = new Population(Population::Load(path, distributionGenerator));
+		auto timer = m_Metrics.Measure("LoadPopulation");
+		m_Population = new Population(Population::Load(path, distributionGenerator, m_ThreadPool));
+		m_Population->SetMemoryBudget(m_MemoryBudget);
+		timer.AddBytes(static_cast<std::uint64_t>(m_Population->GetSize()) * sizeof(double));
+		SelectPopulation();
+	}
+	void Simulator::LoadBinaryPopulation(const std::string& path, DistributionGenerator* distributionGenerator) {
+		auto timer = m_Metrics.Measure("LoadBinaryPopulation");
+		m_Population = new Population(Population::LoadBinary(path, distributionGenerator));
+		m_Population->SetMemoryBudget(m_MemoryBudget);
+		timer.AddBytes(static_cast<std::uint64_t>(m_Population->GetSize()) * sizeof(double));
 		SelectPopulation();
 	}
+	void Simulator::GenerateBinaryPopulation(const std::string& path, std::int64_t size, DistributionGenerator* distributionGenerator) {
+		assert(size >= 1);
+
+		{
+			const auto timer = m_Metrics.Measure("GenerateBinaryPopulation", static_cast<std::uint64_t>(size) * sizeof(double));
+			const std::unique_ptr<Distribution> distribution(distributionGenerator->Generate());
+			Population::GenerateBinary(path, static_cast<std::uint64_t>(size), distribution.get(), m_ThreadPool);
+		}
+		LoadBinaryPopulation(path, distributionGenerator);
+	}
+	void Simulator::ConvertPopulation(const std::string& textPath, const std::string& binaryPath, DistributionGenerator* distributionGenerator) {
+		{
+			const auto timer = m_Metrics.Measure("ConvertPopulation");
+			Population::ConvertToBinary(textPath, binaryPath, distributionGenerator, m_ThreadPool);
+		}
+		LoadBinaryPopulation(binaryPath, distributionGenerator);
+	}
 
 	Data* Simulator::GetSelectedData() noexcept {
 		return m_SelectedData;
@@ -28,10 +72,27 @@ namespace StatSim {
 	bool Simulator::IsPopulationSelected() const noexcept {
 		return m_SelectedData == m_Population;
 	}
+	ThreadPool& Simulator::GetThreadPool() noexcept {
+		return m_ThreadPool;
+	}
+	Metrics& Simulator::GetMetrics() noexcept {
+		return m_Metrics;
+	}
+	void Simulator::SetMetricsPath(std::string path) {
+		m_MetricsPath = std::move(path);
+	}
+	void Simulator::SetMemoryBudget(std::size_t budget) {
+		m_MemoryBudget = budget;
+		if (m_Population != nullptr) {
+			m_Population->SetMemoryBudget(budget);
+		}
+	}
 
 	void Simulator::PrintSelectedData() {
-		for (int i = 0; i < m_SelectedData->GetSize(); ++i) {
-			std::cout << (*m_SelectedData)[i] << ' ';
-		}
+		PrintSelectedData(0, m_SelectedData->GetSize(), 1);
+	}
+	void Simulator::PrintSelectedData(std::int64_t begin, std::int64_t end, int stride) {
+		const auto timer = m_Metrics.Measure("PrintData", static_cast<std::uint64_t>((end - begin + stride - 1) / stride) * sizeof(double));
+		DataWriter(std::cout, ' ', static_cast<int>(std::cout.precision()), &m_ThreadPool).Write(*m_SelectedData, begin, end, stride);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include <StatSim/Sort.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace StatSim {
+	namespace {
+		constexpr int RadixBits = 11;
+		constexpr int RadixPassCount = 6;
+		constexpr std::size_t RadixSize = std::size_t(1) << RadixBits;
+		constexpr std::uint64_t SignBit = std::uint64_t(1) << 63;
+
+		// 양수는 부호 비트를 켜고, 음수는 모든 비트를 뒤집으면 부호 없는 정수의 순서가 실수의 순서와 같아집니다.
+		std::uint64_t ToKey(double value) noexcept {
+			std::uint64_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return bits & SignBit ? ~bits : bits | SignBit;
+		}
+		double FromKey(std::uint64_t key) noexcept {
+			const std::uint64_t bits = key & SignBit ? key & ~SignBit : ~key;
+			double value;
+			std::memcpy(&value, &bits, sizeof(value));
+			return value;
+		}
+
+		void ForEachChunk(std::size_t count, std::size_t chunkCount, ThreadPool* threadPool, const ThreadPool::ChunkFunction& function) {
+			const auto run = [&](std::size_t first, std::size_t last, int) {
+				for (std::size_t chunk = first; chunk < last; ++chunk) {
+					function(count * chunk / chunkCount, count * (chunk + 1) / chunkCount, static_cast<int>(chunk));
+				}
+			};
+			if (threadPool && chunkCount > 1) {
+				threadPool->ParallelFor(chunkCount, run);
+			} else {
+				run(0, chunkCount, 0);
+			}
+		}
+
+		// 키는 값의 자리(double)와 버퍼(std::uint64_t)를 오가며 정렬되므로, 값의 자리에는 memcpy로 비트만 옮깁니다.
+		std::uint64_t LoadKey(const double* keys, std::size_t index) noexcept {
+			std::uint64_t key;
+			std::memcpy(&key, keys + index, sizeof(key));
+			return key;
+		}
+		std::uint64_t LoadKey(const std::uint64_t* keys, std::size_t index) noexcept {
+			return keys[index];
+		}
+		void StoreKey(double* keys, std::size_t index, std::uint64_t key) noexcept {
+			std::memcpy(keys + index, &key, sizeof(key));
+		}
+		void StoreKey(std::uint64_t* keys, std::size_t index, std::uint64_t key) noexcept {
+			keys[index] = key;
+		}
+
+		template<typename Source, typename Destination>
+		bool RadixPass(const Source* source, Destination* destination, std::size_t count, int shift,
+			std::vector<std::array<std::size_t, RadixSize>>& histograms, ThreadPool* threadPool) {
+			const std::size_t chunkCount = histograms.size();
+			ForEachChunk(count, chunkCount, threadPool, [&](std::size_t first, std::size_t last, int chunk) {
+				auto& histogram = histograms[chunk];
+				histogram.fill(0);
+				for (std::size_t i = first; i < last; ++i) {
+					++histogram[(LoadKey(source, i) >> shift) & (RadixSize - 1)];
+				}
+			});
+
+			// 모든 키의 자릿값이 같으면 이 자리는 건너뜁니다.
+			for (std::size_t digit = 0; digit < RadixSize; ++digit) {
+				std::size_t total = 0;
+				for (const auto& histogram : histograms) {
+					total += histogram[digit];
+				}
+				if (total == count) return false;
+				else if (total != 0) break;
+			}
+
+			std::size_t offset = 0;
+			for (std::size_t digit = 0; digit < RadixSize; ++digit) {
+				for (auto& histogram : histograms) {
+					const std::size_t size = histogram[digit];
+					histogram[digit] = offset;
+					offset += size;
+				}
+			}
+
+			ForEachChunk(count, chunkCount, threadPool, [&](std::size_t first, std::size_t last, int chunk) {
+				auto& histogram = histograms[chunk];
+				for (std::size_t i = first; i < last; ++i) {
+					const std::uint64_t key = LoadKey(source, i);
+					StoreKey(destination, histogram[(key >> shift) & (RadixSize - 1)]++, key);
+				}
+			});
+			return true;
+		}
+
+		void RadixSort(std::span<double> values, ThreadPool* threadPool) {
+			const std::size_t count = values.size();
+			const std::size_t chunkCount = threadPool ? std::min<std::size_t>(threadPool->GetThreadCount(), count / MinRadixSortSize + 1) : 1;
+
+			ForEachChunk(count, chunkCount, threadPool, [&](std::size_t first, std::size_t last, int) {
+				for (std::size_t i = first; i < last; ++i) {
+					StoreKey(values.data(), i, ToKey(values[i]));
+				}
+			});
+
+			std::vector<std::uint64_t> buffer(count);
+			std::vector<std::array<std::size_t, RadixSize>> histograms(chunkCount);
+			bool isInBuffer = false;
+			for (int pass = 0; pass < RadixPassCount; ++pass) {
+				const int shift = pass * RadixBits;
+				const bool isMoved = isInBuffer ? RadixPass(buffer.data(), values.data(), count, shift, histograms, threadPool) :
+					RadixPass(values.data(), buffer.data(), count, shift, histograms, threadPool);
+				if (isMoved) {
+					isInBuffer = !isInBuffer;
+				}
+			}
+
+			ForEachChunk(count, chunkCount, threadPool, [&](std::size_t first, std::size_t last, int) {
+				for (std::size_t i = first; i < last; ++i) {
+					values[i] = FromKey(isInBuffer ? buffer[i] : LoadKey(values.data(), i));
+				}
+			});
+		}
+
+		void MergeSort(std::span<double> values, ThreadPool* threadPool) {
+			const std::size_t count = values.size();
+			const std::size_t chunkCount = threadPool ? static_cast<std::size_t>(threadPool->GetThreadCount()) : 1;
+			const auto boundary = [&](std::size_t chunk) {
+				return values.begin() + count * std::min(chunk, chunkCount) / chunkCount;
+			};
+
+			ForEachChunk(count, chunkCount, threadPool, [&](std::size_t first, std::size_t last, int) {
+				std::sort(values.begin() + first, values.begin() + last);
+			});
+
+			// 정렬된 구간을 둘씩 병렬로 합치며, 구간의 수가 절반씩 줄어듭니다.
+			for (std::size_t width = 1; width < chunkCount; width *= 2) {
+				const std::size_t mergeCount = (chunkCount + 2 * width - 1) / (2 * width);
+				ForEachChunk(mergeCount, mergeCount, threadPool, [&](std::size_t first, std::size_t, int) {
+					const std::size_t chunk = first * 2 * width;
+					std::inplace_merge(boundary(chunk), boundary(chunk + width), boundary(chunk + 2 * width));
+				});
+			}
+		}
+	}
+
+	void SortValues(std::span<double> values, ThreadPool* threadPool) {
+		if (values.size() < MinRadixSortSize) {
+			std::sort(values.begin(), values.end());
+		} else if (values.size() <= MaxRadixSortSize) {
+			RadixSort(values, threadPool);
+		} else {
+			MergeSort(values, threadPool);
+		}
+	}
+}
@@ -0,0 +1,104 @@
+#include <StatSim/ThreadPool.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+
+namespace StatSim {
+	ThreadPool::ThreadPool(int threadCount) {
+		assert(threadCount >= 0);
+
+		if (threadCount == 0) {
+			threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+		}
+
+		// 호출한 스레드도 작업 하나를 맡으므로, 작업자 스레드는 하나 적게 만듭니다.
+		for (int i = 1; i < threadCount; ++i) {
+			m_Workers.emplace_back(&ThreadPool::Run, this);
+		}
+	}
+	ThreadPool::~ThreadPool() {
+		{
+			const std::lock_guard lock(m_Mutex);
+			m_IsStopping = true;
+		}
+		m_Condition.notify_all();
+
+		for (auto& worker : m_Workers) {
+			worker.join();
+		}
+	}
+
+	int ThreadPool::GetThreadCount() const noexcept {
+		return static_cast<int>(m_Workers.size()) + 1;
+	}
+
+	void ThreadPool::ParallelFor(std::size_t count, const ChunkFunction& function) {
+		if (count == 0) return;
+
+		const std::size_t chunkCount = std::min(count, static_cast<std::size_t>(GetThreadCount()));
+		const std::size_t chunkSize = count / chunkCount, remainder = count % chunkCount;
+		const auto chunkBegin = [&](std::size_t chunk) {
+			return chunk * chunkSize + std::min(chunk, remainder);
+		};
+
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::size_t remaining = chunkCount - 1;
+		std::exception_ptr exception;
+
+		const auto runChunk = [&](std::size_t chunk) {
+			try {
+				function(chunkBegin(chunk), chunkBegin(chunk + 1), static_cast<int>(chunk));
+			} catch (...) {
+				const std::lock_guard lock(mutex);
+				if (!exception) {
+					exception = std::current_exception();
+				}
+			}
+		};
+
+		{
+			const std::lock_guard lock(m_Mutex);
+			for (std::size_t chunk = 1; chunk < chunkCount; ++chunk) {
+				m_Tasks.push([&, chunk]() {
+					runChunk(chunk);
+
+					const std::lock_guard lock(mutex);
+					if (--remaining == 0) {
+						condition.notify_one();
+					}
+				});
+			}
+		}
+		m_Condition.notify_all();
+
+		runChunk(0);
+
+		std::unique_lock lock(mutex);
+		condition.wait(lock, [&]() {
+			return remaining == 0;
+		});
+
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+
+	void ThreadPool::Run() {
+		while (true) {
+			std::function<void()> task;
+			{
+				std::unique_lock lock(m_Mutex);
+				m_Condition.wait(lock, [this]() {
+					return m_IsStopping || !m_Tasks.empty();
+				});
+				if (m_IsStopping && m_Tasks.empty()) return;
+
+				task = std::move(m_Tasks.front());
+				m_Tasks.pop();
+			}
+			task();
+		}
+	}
+}
\ No newline at end of file